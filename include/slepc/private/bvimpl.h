@@ -93,6 +93,7 @@ struct _p_BV {
   PetscObjectId      id[2];        /* object id of obtained vectors */
   PetscScalar        *h,*c;        /* orthogonalization coefficients */
   Vec                omega;        /* signature matrix values for indefinite case */
+  Vec                Bdiag;        /* diagonal of the inner product matrix, if it is a signature matrix */
   PetscBool          defersfo;     /* deferred call to setfromoptions */
   BV                 cached;       /* cached BV to store result of matrix times BV */
   PetscObjectState   bvstate;      /* state of BV when BVApplyMatrixBV() was called */
@@ -149,13 +150,34 @@ static inline PetscErrorCode BV_IPMatMult(BV bv,Vec x)
   PetscFunctionBegin;
   if (((PetscObject)x)->id != bv->xid || ((PetscObject)x)->state != bv->xstate) {
     if (PetscUnlikely(!bv->Bx)) PetscCall(MatCreateVecs(bv->matrix,&bv->Bx,NULL));
-    PetscCall(MatMult(bv->matrix,x,bv->Bx));
+    if (bv->Bdiag) PetscCall(VecPointwiseMult(bv->Bx,bv->Bdiag,x));
+    else PetscCall(MatMult(bv->matrix,x,bv->Bx));
     PetscCall(PetscObjectGetId((PetscObject)x,&bv->xid));
     PetscCall(VecGetState(x,&bv->xstate));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+  BV_DiagonalMultBV - Computes Y = B*X in the active columns when the inner-product
+  matrix B is diagonal, with pointwise products by the diagonal kept in X->Bdiag.
+*/
+static inline PetscErrorCode BV_DiagonalMultBV(BV X,BV Y)
+{
+  PetscInt j;
+  Vec      x,y;
+
+  PetscFunctionBegin;
+  for (j=0;j<X->k-X->l;j++) {
+    PetscCall(BVGetColumn(X,X->l+j,&x));
+    PetscCall(BVGetColumn(Y,Y->l+j,&y));
+    PetscCall(VecPointwiseMult(y,X->Bdiag,x));
+    PetscCall(BVRestoreColumn(Y,Y->l+j,&y));
+    PetscCall(BVRestoreColumn(X,X->l+j,&x));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
   BV_IPMatMultBV - Multiply BV by the inner-product matrix, cache the
   result internally in bv->cached.
@@ -166,7 +188,8 @@ static inline PetscErrorCode BV_IPMatMultBV(BV bv)
   PetscCall(BVGetCachedBV(bv,&bv->cached));
   if (((PetscObject)bv)->state != bv->bvstate || bv->l != bv->cached->l || bv->k != bv->cached->k) {
     PetscCall(BVSetActiveColumns(bv->cached,bv->l,bv->k));
-    if (bv->matrix) PetscCall(BVMatMult(bv,bv->matrix,bv->cached));
+    if (bv->Bdiag) PetscCall(BV_DiagonalMultBV(bv,bv->cached));
+    else if (bv->matrix) PetscCall(BVMatMult(bv,bv->matrix,bv->cached));
     else PetscCall(BVCopy(bv,bv->cached));
     bv->bvstate = ((PetscObject)bv)->state;
   }
@@ -210,7 +233,8 @@ static inline PetscErrorCode BV_AllocateSignature(BV bv)
 
 /*
   BV_SetMatrixDiagonal - sets the inner product matrix for BV as a diagonal matrix
-  with the diagonal specified by vector vomega, using the same matrix type as matrix M
+  with the diagonal specified by vector vomega, using the same matrix type as matrix M;
+  a copy of vomega is kept so that inner products and norms avoid the matrix-vector product
 */
 static inline PetscErrorCode BV_SetMatrixDiagonal(BV bv,Vec vomega,Mat M)
 {
@@ -225,6 +249,9 @@ static inline PetscErrorCode BV_SetMatrixDiagonal(BV bv,Vec vomega,Mat M)
   PetscCall(MatDiagonalSet(Omega,vomega,INSERT_VALUES));
   PetscCall(BVSetMatrix(bv,Omega,PETSC_TRUE));
   PetscCall(MatDestroy(&Omega));
+  PetscCall(VecDestroy(&bv->Bdiag));
+  PetscCall(VecDuplicate(vomega,&bv->Bdiag));
+  PetscCall(VecCopy(vomega,bv->Bdiag));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -42,6 +42,7 @@ struct _DSOps {
   PetscErrorCode (*synchronize)(DS,PetscScalar*,PetscScalar*);
   PetscErrorCode (*setcompact)(DS,PetscBool);
   PetscErrorCode (*reallocate)(DS,PetscInt);
+  PetscErrorCode (*solvebatch)(DS,PetscInt,PetscInt,PetscInt,PetscScalar*,PetscScalar*,PetscScalar*,PetscScalar*);
 };
 
 struct _p_DS {
@@ -128,6 +129,12 @@ SLEPC_INTERN PetscErrorCode DSSwitchFormat_GHIEP(DS,PetscBool);
 SLEPC_INTERN PetscErrorCode DSGHIEPRealBlocks(DS);
 SLEPC_INTERN PetscErrorCode DSSolve_GHIEP_HZ(DS,PetscScalar*,PetscScalar*);
 SLEPC_INTERN PetscErrorCode DSArrowTridiag(PetscBLASInt,PetscReal*,PetscReal*,PetscScalar*,PetscBLASInt);
+SLEPC_INTERN PetscErrorCode DSReduceDistributed_HEP(Mat,PetscReal*,PetscReal*,PetscScalar*);
+SLEPC_INTERN PetscErrorCode DSSolveDistributed_HEP(SlepcSC,PetscInt,const PetscReal*,const PetscReal*,PetscInt,PetscScalar*,PetscInt,PetscInt,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode DSBackTransformDistributed_HEP(Mat,const PetscScalar*,PetscInt,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode DSReduceDistributed_SVD(Mat,PetscReal*,PetscReal*,PetscScalar*,PetscScalar*,PetscScalar*);
+SLEPC_INTERN PetscErrorCode DSSolveDistributed_SVD(PetscInt,const PetscReal*,const PetscReal*,PetscBool,PetscInt,PetscReal*,PetscInt,PetscInt,PetscScalar*,PetscInt,PetscInt,PetscInt,PetscScalar*,PetscInt);
+SLEPC_INTERN PetscErrorCode DSBackTransformDistributed_SVD(Mat,const PetscScalar*,const PetscScalar*,const PetscScalar*,PetscInt,PetscScalar*,PetscInt,PetscScalar*,PetscInt);
 
 SLEPC_INTERN PetscErrorCode DSSolve_NHEP_Private(DS,DSMatType,DSMatType,PetscScalar*,PetscScalar*);
 SLEPC_INTERN PetscErrorCode DSSort_NHEP_Total(DS,DSMatType,DSMatType,PetscScalar*,PetscScalar*);
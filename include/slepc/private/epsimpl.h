@@ -42,6 +42,7 @@ struct _EPSOps {
    Maximum number of monitors you can run with a single EPS
 */
 #define MAXEPSMONITORS 5
+#define EPS_CHECKPOINT_CLASSID 1211290   /* identifies checkpoints in binary files */
 
 /*
    The solution process goes through several states
@@ -101,6 +102,10 @@ struct _p_EPS {
   PetscBool      trackall;         /* whether all the residuals must be computed */
   PetscBool      purify;           /* whether eigenvectors need to be purified */
   PetscBool      twosided;         /* whether to compute left eigenvectors (two-sided solver) */
+  PetscBool      recycle;          /* whether the converged subspace is recycled in the next solve */
+  PetscInt       nrecextra;        /* number of extra Ritz vectors kept for recycling */
+  PetscViewer    ckptviewer;       /* binary viewer where checkpoints are written */
+  PetscInt       ckptevery;        /* number of restarts between two checkpoints */
 
   /*-------------- User-provided functions and contexts -----------------*/
   EPSConvergenceTestFn      *converged;
@@ -141,6 +146,7 @@ struct _p_EPS {
   EPSSolverType  categ;            /* solver category */
   PetscInt       nconv;            /* number of converged eigenvalues */
   PetscInt       its;              /* number of iterations so far computed */
+  PetscInt       nrec;             /* number of columns of V available for recycling */
   PetscInt       n,nloc;           /* problem dimensions (global, local) */
   PetscReal      nrma,nrmb;        /* computed matrix norms */
   PetscBool      useds;            /* whether the solver uses the DS object or not */
@@ -443,6 +449,8 @@ SLEPC_INTERN PetscErrorCode EPSComputeVectors_Slice(EPS);
 SLEPC_INTERN PetscErrorCode EPSComputeResidualNorm_Private(EPS,PetscBool,PetscScalar,PetscScalar,Vec,Vec,Vec*,PetscReal*);
 SLEPC_INTERN PetscErrorCode EPSComputeRitzVector(EPS,PetscScalar*,PetscScalar*,BV,Vec,Vec);
 SLEPC_INTERN PetscErrorCode EPSGetStartVector(EPS,PetscInt,PetscBool*);
+SLEPC_INTERN PetscErrorCode EPSGetRecycledSubspace(EPS);
+SLEPC_INTERN PetscErrorCode EPSCheckpointWrite(EPS,PetscInt);
 SLEPC_INTERN PetscErrorCode EPSGetLeftStartVector(EPS,PetscInt,PetscBool*);
 SLEPC_INTERN PetscErrorCode MatEstimateSpectralRange_EPS(Mat,PetscReal*,PetscReal*);
 
@@ -450,6 +458,7 @@ SLEPC_INTERN PetscErrorCode MatEstimateSpectralRange_EPS(Mat,PetscReal*,PetscRea
 
 SLEPC_INTERN PetscErrorCode EPSDelayedArnoldi(EPS,PetscScalar*,PetscInt,PetscInt,PetscInt*,PetscReal*,PetscBool*);
 SLEPC_INTERN PetscErrorCode EPSDelayedArnoldi1(EPS,PetscScalar*,PetscInt,PetscInt,PetscInt*,PetscReal*,PetscBool*);
+SLEPC_INTERN PetscErrorCode EPSBatchedLanczos(EPS,PetscReal*,PetscReal*,PetscInt,PetscInt*,PetscInt,PetscBool*);
 SLEPC_INTERN PetscErrorCode EPSKrylovConvergence(EPS,PetscBool,PetscInt,PetscInt,PetscReal,PetscReal,PetscReal,PetscInt*);
 SLEPC_INTERN PetscErrorCode EPSPseudoLanczos(EPS,PetscReal*,PetscReal*,PetscReal*,PetscInt,PetscInt*,PetscBool*,PetscBool*,PetscReal*,Vec);
 SLEPC_INTERN PetscErrorCode EPSBuildBalance_Krylov(EPS);
@@ -114,6 +114,7 @@ struct _p_SVD {
   PetscBool      leftbasis;        /* if U is filled by the solver */
   PetscBool      swapped;          /* the U and V bases have been swapped (M<N) */
   PetscBool      expltrans;        /* explicit transpose created */
+  PetscBool      updated;          /* triplets obtained with SVDUpdate(), next solve must set up */
   PetscReal      nrma,nrmb;        /* computed matrix norms */
   PetscBool      isgeneralized;
   PetscBool      ishyperbolic;
@@ -190,6 +191,16 @@ struct _p_SVD {
     } \
   } while (0)
 
+/*
+    SVDThresholdGrow - Whether the basis must be enlarged in the threshold stopping test, because
+    few unconverged vectors remain or because the smallest Ritz value of a full subspace of size nv
+    is still above the threshold (hence at least nv singular values are above it, by interlacing;
+    in hyperbolic problems the Ritz values do not interlace, and this is only a heuristic)
+*/
+#define SVDThresholdGrow(svd,k,nv) \
+  ((svd)->stop==SVD_STOP_THRESHOLD && ((nv)-(k)<5 || ((svd)->which==SVD_LARGEST && (nv)==(svd)->ncv && (svd)->mpd+(k)>(svd)->ncv && \
+   (svd)->sigma[(nv)-1]>((svd)->threlative?(svd)->thres*(svd)->sigma[0]:(svd)->thres))))
+
 /*
   SVD_KSPSetOperators - Sets the KSP matrices
 */
@@ -238,6 +249,9 @@ static inline PetscErrorCode SVDCreateLeftTemplate(SVD svd,Vec *t)
 
 SLEPC_INTERN PetscErrorCode SVDKrylovConvergence(SVD,PetscBool,PetscInt,PetscInt,PetscReal,PetscInt*);
 SLEPC_INTERN PetscErrorCode SVDTwoSideLanczos(SVD,PetscReal*,PetscReal*,BV,BV,PetscInt,PetscInt*,PetscBool*);
+SLEPC_INTERN PetscErrorCode SVDThickRestartLanczos(SVD,PetscBool,PetscReal,PetscBool);
 SLEPC_INTERN PetscErrorCode SVDSetDimensions_Default(SVD);
 SLEPC_INTERN PetscErrorCode SVDComputeVectors(SVD);
 SLEPC_INTERN PetscErrorCode SVDComputeVectors_Left(SVD);
+SLEPC_INTERN PetscErrorCode SVDComputeResidualNorms_Generalized(SVD,PetscReal,Vec,Vec,Vec,Vec,PetscReal*,PetscReal*);
+SLEPC_INTERN PetscErrorCode SVDBlockMatMult(BV,Mat,BV,Mat);
@@ -247,6 +247,8 @@ SLEPC_EXTERN PetscErrorCode BVCISSResizeBases(BV,BV,BV,PetscInt,PetscInt,PetscIn
 SLEPC_EXTERN PetscErrorCode BVCreateTensor(BV,PetscInt,BV*);
 SLEPC_EXTERN PetscErrorCode BVTensorBuildFirstColumn(BV,PetscInt);
 SLEPC_EXTERN PetscErrorCode BVTensorCompress(BV,PetscInt);
+SLEPC_EXTERN PetscErrorCode BVTensorSetCompressTolerance(BV,PetscReal);
+SLEPC_EXTERN PetscErrorCode BVTensorGetCompressTolerance(BV,PetscReal*);
 SLEPC_EXTERN PetscErrorCode BVTensorGetDegree(BV,PetscInt*);
 SLEPC_EXTERN PetscErrorCode BVTensorGetFactors(BV,BV*,Mat*);
 SLEPC_EXTERN PetscErrorCode BVTensorRestoreFactors(BV,BV*,Mat*);
@@ -282,6 +282,11 @@ SLEPC_EXTERN PetscErrorCode EPSSetTwoSided(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetTwoSided(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSSetTrueResidual(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetTrueResidual(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSetRecycle(EPS,PetscBool,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSGetRecycle(EPS,PetscBool*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSSetCheckpoint(EPS,PetscViewer,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSGetCheckpoint(EPS,PetscViewer*,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSLoadCheckpoint(EPS,PetscViewer);
 SLEPC_EXTERN PetscErrorCode EPSSetPurify(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSGetPurify(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSIsGeneralized(EPS,PetscBool*);
@@ -394,6 +399,8 @@ SLEPC_EXTERN PetscErrorCode EPSPowerSetUpdate(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetUpdate(EPS,PetscBool*);
 SLEPC_EXTERN PetscErrorCode EPSPowerSetSignNormalization(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetSignNormalization(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSPowerSetBlockSize(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSPowerGetBlockSize(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSPowerSetSNES(EPS,SNES);
 SLEPC_EXTERN PetscErrorCode EPSPowerGetSNES(EPS,SNES*);
 
@@ -419,6 +426,8 @@ SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetRestart(EPS,PetscReal);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetRestart(EPS,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetLocking(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetLocking(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetBatchReorthog(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetBatchReorthog(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetPartitions(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurGetPartitions(EPS,PetscInt*);
 SLEPC_EXTERN PetscErrorCode EPSKrylovSchurSetDetectZeros(EPS,PetscBool);
@@ -452,6 +461,8 @@ SLEPC_EXTERN const char *EPSLanczosReorthogTypes[];
 
 SLEPC_EXTERN PetscErrorCode EPSLanczosSetReorthog(EPS,EPSLanczosReorthogType);
 SLEPC_EXTERN PetscErrorCode EPSLanczosGetReorthog(EPS,EPSLanczosReorthogType*);
+SLEPC_EXTERN PetscErrorCode EPSLanczosSetTwoPass(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSLanczosGetTwoPass(EPS,PetscBool*);
 
 /*E
     EPSPRIMMEMethod - determines the method selected in the PRIMME library
@@ -512,6 +523,8 @@ SLEPC_EXTERN PetscErrorCode EPSJDGetBOrth(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSRQCGSetReset(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSRQCGGetReset(EPS,PetscInt*);
+SLEPC_EXTERN PetscErrorCode EPSRQCGSetBlock(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSRQCGGetBlock(EPS,PetscBool*);
 
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetBlockSize(EPS,PetscInt);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetBlockSize(EPS,PetscInt*);
@@ -520,6 +533,11 @@ SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetRestart(EPS,PetscReal*);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGSetLocking(EPS,PetscBool);
 SLEPC_EXTERN PetscErrorCode EPSLOBPCGGetLocking(EPS,PetscBool*);
 
+SLEPC_EXTERN PetscErrorCode EPSSubspaceSetChebyshev(EPS,PetscBool);
+SLEPC_EXTERN PetscErrorCode EPSSubspaceGetChebyshev(EPS,PetscBool*);
+SLEPC_EXTERN PetscErrorCode EPSSubspaceSetChebyshevDegree(EPS,PetscInt);
+SLEPC_EXTERN PetscErrorCode EPSSubspaceGetChebyshevDegree(EPS,PetscInt*);
+
 /*E
     EPSCISSQuadRule - determines the quadrature rule in the CISS solver
 
@@ -368,6 +368,8 @@ SLEPC_EXTERN PetscErrorCode NEPRIISetHermitian(NEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetHermitian(NEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode NEPRIISetDeflationThreshold(NEP,PetscReal);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetDeflationThreshold(NEP,PetscReal*);
+SLEPC_EXTERN PetscErrorCode NEPRIISetBlockIteration(NEP,PetscBool);
+SLEPC_EXTERN PetscErrorCode NEPRIIGetBlockIteration(NEP,PetscBool*);
 SLEPC_EXTERN PetscErrorCode NEPRIISetKSP(NEP,KSP);
 SLEPC_EXTERN PetscErrorCode NEPRIIGetKSP(NEP,KSP*);
 
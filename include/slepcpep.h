@@ -383,6 +383,9 @@ SLEPC_EXTERN PetscErrorCode PEPSTOARSetDimensions(PEP,PetscInt,PetscInt,PetscInt
 SLEPC_EXTERN PetscErrorCode PEPSTOARGetDimensions(PEP,PetscInt*,PetscInt*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode PEPSTOARSetCheckEigenvalueType(PEP,PetscBool);
 SLEPC_EXTERN PetscErrorCode PEPSTOARGetCheckEigenvalueType(PEP,PetscBool*);
+SLEPC_EXTERN PetscErrorCode PEPSTOARSetPartitions(PEP,PetscInt);
+SLEPC_EXTERN PetscErrorCode PEPSTOARGetPartitions(PEP,PetscInt*);
+SLEPC_EXTERN PetscErrorCode PEPSTOARSetSubintervals(PEP,PetscReal*);
 SLEPC_EXTERN PetscErrorCode PEPCheckDefiniteQEP(PEP,PetscReal*,PetscReal*,PetscInt*,PetscInt*);
 
 /*E
@@ -406,6 +409,8 @@ SLEPC_EXTERN PetscErrorCode PEPJDSetMinimalityIndex(PEP,PetscInt);
 SLEPC_EXTERN PetscErrorCode PEPJDGetMinimalityIndex(PEP,PetscInt*);
 SLEPC_EXTERN PetscErrorCode PEPJDSetProjection(PEP,PEPJDProjection);
 SLEPC_EXTERN PetscErrorCode PEPJDGetProjection(PEP,PEPJDProjection*);
+SLEPC_EXTERN PetscErrorCode PEPJDSetBlockSize(PEP,PetscInt);
+SLEPC_EXTERN PetscErrorCode PEPJDGetBlockSize(PEP,PetscInt*);
 
 /*E
     PEPCISSExtraction - determines the extraction technique in the CISS solver
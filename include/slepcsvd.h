@@ -200,6 +200,7 @@ SLEPC_EXTERN PetscErrorCode SVDStoppingThreshold(SVD,PetscInt,PetscInt,PetscInt,
 SLEPC_EXTERN PetscErrorCode SVDGetConvergedReason(SVD,SVDConvergedReason*);
 SLEPC_EXTERN PetscErrorCode SVDGetConverged(SVD,PetscInt*);
 SLEPC_EXTERN PetscErrorCode SVDGetSingularTriplet(SVD,PetscInt,PetscReal*,Vec,Vec);
+SLEPC_EXTERN PetscErrorCode SVDUpdate(SVD,Mat,Mat);
 SLEPC_EXTERN PetscErrorCode SVDComputeError(SVD,PetscInt,SVDErrorType,PetscReal*);
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "SVDComputeError()", ) static inline PetscErrorCode SVDComputeRelativeError(SVD svd,PetscInt i,PetscReal *r) {return SVDComputeError(svd,i,SVD_ERROR_RELATIVE,r);}
 PETSC_DEPRECATED_FUNCTION(3, 6, 0, "SVDComputeError() with SVD_ERROR_ABSOLUTE", ) static inline PetscErrorCode SVDComputeResidualNorms(SVD svd,PetscInt i,PetscReal *r1,PETSC_UNUSED PetscReal *r2) {return SVDComputeError(svd,i,SVD_ERROR_ABSOLUTE,r1);}
@@ -295,11 +296,17 @@ SLEPC_EXTERN PetscErrorCode SVDSetStoppingTestFunction(SVD,SVDStoppingTestFn*,vo
 
 SLEPC_EXTERN PetscErrorCode SVDCrossSetExplicitMatrix(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDCrossGetExplicitMatrix(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDCrossSetFusedProduct(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDCrossGetFusedProduct(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDCrossSetSketch(SVD,PetscBool,PetscInt);
+SLEPC_EXTERN PetscErrorCode SVDCrossGetSketch(SVD,PetscBool*,PetscInt*);
 SLEPC_EXTERN PetscErrorCode SVDCrossSetEPS(SVD,EPS);
 SLEPC_EXTERN PetscErrorCode SVDCrossGetEPS(SVD,EPS*);
 
 SLEPC_EXTERN PetscErrorCode SVDCyclicSetExplicitMatrix(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDCyclicGetExplicitMatrix(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDCyclicSetStructured(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDCyclicGetStructured(SVD,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SVDCyclicSetEPS(SVD,EPS);
 SLEPC_EXTERN PetscErrorCode SVDCyclicGetEPS(SVD,EPS*);
 
@@ -331,8 +338,12 @@ SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetRestart(SVD,PetscReal);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetRestart(SVD,PetscReal*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetLocking(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetLocking(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetBlockSize(SVD,PetscInt);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetBlockSize(SVD,PetscInt*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetExplicitMatrix(SVD,PetscBool);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetExplicitMatrix(SVD,PetscBool*);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetInexact(SVD,PetscBool);
+SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetInexact(SVD,PetscBool*);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosSetScale(SVD,PetscReal);
 SLEPC_EXTERN PetscErrorCode SVDTRLanczosGetScale(SVD,PetscReal*);
 
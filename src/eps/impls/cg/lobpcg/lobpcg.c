@@ -15,7 +15,10 @@
    Algorithm:
 
        LOBPCG with soft and hard locking. Follows the implementation
-       in BLOPEX [2].
+       in BLOPEX [2]. The images of the search directions are updated
+       without additional matrix-vector products, and all the Gram
+       matrices are computed with a single reduction, stabilizing the
+       projected problem as in SVQB [3].
 
    References:
 
@@ -26,9 +29,17 @@
        [2] A. V. Knyazev et al., "Block Locally Optimal Preconditioned
            Eigenvalue Xolvers (BLOPEX) in Hypre and PETSc", SIAM J. Sci.
            Comput. 29(5):2224-2239, 2007.
+
+       [3] A. Stathopoulos and K. Wu, "A block orthogonalization procedure
+           with constant synchronization requirements", SIAM J. Sci. Comput.
+           23(6):2165-2182, 2002.
 */
 
 #include <slepc/private/epsimpl.h>                /*I "slepceps.h" I*/
+#include <slepcblaslapack.h>
+
+/* A*X and B*X are updated with the Ritz coefficients, and recomputed every this many iterations to avoid drift */
+#define LOBPCG_REFRESH 10
 
 typedef struct {
   PetscInt  bs;        /* block size */
@@ -83,16 +94,130 @@ static PetscErrorCode EPSSetUp_LOBPCG(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Copy the active columns of X onto Y, starting at column j
+*/
+static inline PetscErrorCode EPSLOBPCGCopyBlock(BV X,BV Y,PetscInt j)
+{
+  PetscInt l,k;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetActiveColumns(X,&l,&k));
+  PetscCall(BVSetActiveColumns(Y,j,j+k-l));
+  PetscCall(BVCopy(X,Y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Rayleigh-Ritz with the Gram matrices G = Z'*[A*Z B*Z], where the B-part
+   starts at column off. Instead of B-orthonormalizing the blocks of Z, the
+   small problem is stabilized as in SVQB: with D=diag(GB)^{-1/2} and
+   D*GB*D = U*L*U', the directions associated with tiny eigenvalues are
+   discarded and the projected problem T'*GA*T is solved with T = D*U*L^{-1/2}.
+   On output, C contains T times the first bs eigenvectors (replicated from
+   row off on) and r is the dimension of the reduced problem.
+*/
+static PetscErrorCode EPSLOBPCGRayleighRitz(EPS eps,Mat G,PetscInt nv,PetscInt off,PetscBool flip,PetscScalar *eigr,Mat C,PetscInt *r)
+{
+  EPS_LOBPCG        *ctx = (EPS_LOBPCG*)eps->data;
+  PetscInt          i,j,f,nr,ldg,ldc,ld;
+  const PetscScalar *pG;
+  PetscScalar       *pC,*pA,*pX,*S,*T,*work,a,sone=1.0,szero=0.0,salpha=flip?-1.0:1.0;
+  PetscReal         *eig,*D,d,tol,dummy;
+  PetscBLASInt      n_,r_,bs_,ldg_,ld_,ldc_,lwork,info;
+#if defined(PETSC_USE_COMPLEX)
+  PetscReal         *rwork,rdummy;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(nv,&n_));
+  PetscCall(MatDenseGetLDA(G,&ldg));
+  PetscCall(PetscBLASIntCast(ldg,&ldg_));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+
+  /* workspace query and memory allocation */
+  lwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n_,&a,&n_,&dummy,&a,&lwork,&rdummy,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(a),&lwork));
+  PetscCall(PetscMalloc6(nv*nv,&S,nv*nv,&T,nv,&eig,nv,&D,lwork,&work,PetscMax(1,3*nv-2),&rwork));
+#else
+  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n_,&a,&n_,&dummy,&a,&lwork,&info));
+  PetscCall(PetscBLASIntCast((PetscInt)a,&lwork));
+  PetscCall(PetscMalloc5(nv*nv,&S,nv*nv,&T,nv,&eig,nv,&D,lwork,&work));
+#endif
+
+  /* eigendecomposition of the scaled B-Gram matrix */
+  PetscCall(MatDenseGetArrayRead(G,&pG));
+  for (i=0;i<nv;i++) {
+    d = PetscRealPart(pG[i+(off+i)*ldg]);
+    D[i] = (d>0.0)? 1.0/PetscSqrtReal(d): 0.0;
+  }
+  for (j=0;j<nv;j++) for (i=0;i<nv;i++) S[i+j*nv] = pG[i+(off+j)*ldg]*D[i]*D[j];
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n_,S,&n_,eig,work,&lwork,rwork,&info));
+#else
+  PetscCallBLAS("LAPACKsyev",LAPACKsyev_("V","L",&n_,S,&n_,eig,work,&lwork,&info));
+#endif
+  SlepcCheckLapackInfo("syev",info);
+
+  /* discard directions that are numerically linearly dependent, T = D*U*L^{-1/2} */
+  tol = nv*PETSC_MACHINE_EPSILON*eig[nv-1];
+  for (f=0;f<nv && eig[f]<=tol;f++);
+  nr = nv-f;
+  for (j=0;j<nr;j++) for (i=0;i<nv;i++) T[i+j*nv] = D[i]*S[i+(f+j)*nv]/PetscSqrtReal(eig[f+j]);
+
+  /* projected matrix T'*GA*T, with GA*T stored in S; nothing to do if the rank is too small */
+  if (nr>=ctx->bs) {
+    PetscCall(PetscBLASIntCast(nr,&r_));
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&r_,&n_,&sone,(PetscScalar*)pG,&ldg_,T,&n_,&szero,S,&n_));
+    PetscCall(DSSetDimensions(eps->ds,nr,0,0));
+    PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+    PetscCall(PetscBLASIntCast(ld,&ld_));
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&pA));
+    PetscCallBLAS("BLASgemm",BLASgemm_("C","N",&r_,&r_,&n_,&salpha,T,&n_,S,&n_,&szero,pA,&ld_));
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&pA));
+
+    /* solve the small eigenproblem */
+    PetscCall(DSSetIdentity(eps->ds,DS_MAT_B));
+    PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+    PetscCall(DSSolve(eps->ds,eigr,NULL));
+    PetscCall(DSSort(eps->ds,eigr,NULL,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(eps->ds,eigr,NULL));
+    PetscCall(DSVectors(eps->ds,DS_MAT_X,NULL,NULL));
+
+    /* coefficients of the Ritz vectors in terms of Z */
+    PetscCall(PetscBLASIntCast(ctx->bs,&bs_));
+    PetscCall(MatDenseGetLDA(C,&ldc));
+    PetscCall(PetscBLASIntCast(ldc,&ldc_));
+    PetscCall(MatDenseGetArray(C,&pC));
+    PetscCall(DSGetArray(eps->ds,DS_MAT_X,&pX));
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&n_,&bs_,&r_,&sone,T,&n_,pX,&ld_,&szero,pC,&ldc_));
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_X,&pX));
+    for (j=0;j<ctx->bs;j++) PetscCall(PetscArraycpy(pC+off+j*ldc,pC+j*ldc,nv));
+    PetscCall(MatDenseRestoreArray(C,&pC));
+  }
+  PetscCall(MatDenseRestoreArrayRead(G,&pG));
+  PetscCall(PetscFPTrapPop());
+  *r = nr;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree6(S,T,eig,D,work,rwork));
+#else
+  PetscCall(PetscFree5(S,T,eig,D,work));
+#endif
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
 {
   EPS_LOBPCG     *ctx = (EPS_LOBPCG*)eps->data;
-  PetscInt       i,j,k,nv,ini,nmat,nc,nconv,locked,its,prev=0;
-  PetscReal      norm;
+  PetscInt       i,j,k,nv,ini,nmat,nc,nconv,locked,its,prev=0,r,nref=-1;
+  PetscReal      norm,*rnorm;
   PetscScalar    *eigr,dot;
   PetscBool      breakdown,countc,flip=PETSC_FALSE,checkprecond=PETSC_FALSE;
-  Mat            A,B,M,V=NULL,W=NULL;
+  Mat            A,B,M,G,C,V=NULL,W=NULL;
   Vec            v,z,w=eps->work[0];
-  BV             X,Y=NULL,Z,R,P,AX,BX;
+  BV             X,Y=NULL,Z,R,P,AX,BX,AR,AP,BR,BP,Q;
   SlepcSC        sc;
 
   PetscFunctionBegin;
@@ -111,13 +236,24 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
   PetscCall(PetscOptionsGetBool(NULL,NULL,"-eps_lobpcg_checkprecond",&checkprecond,NULL));
 
   /* 1. Allocate memory */
-  PetscCall(PetscCalloc1(3*ctx->bs,&eigr));
+  PetscCall(PetscCalloc2(3*ctx->bs,&eigr,ctx->bs,&rnorm));
   PetscCall(BVDuplicateResize(eps->V,3*ctx->bs,&Z));
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&X));
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&R));
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&P));
   PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AX));
-  if (B) PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BX));
+  PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AR));
+  PetscCall(BVDuplicateResize(eps->V,ctx->bs,&AP));
+  if (B) {
+    PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BX));
+    PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BR));
+    PetscCall(BVDuplicateResize(eps->V,ctx->bs,&BP));
+  }
+  /* Q holds the images of Z, A*Z in the first 3*bs columns and B*Z in the rest,
+     so that all Gram matrices are obtained with a single reduction */
+  PetscCall(BVDuplicateResize(eps->V,6*ctx->bs,&Q));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,3*ctx->bs,6*ctx->bs,NULL,&G));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,6*ctx->bs,ctx->bs,NULL,&C));
   nc = eps->nds;
   if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDuplicateResize(eps->V,nc+eps->nev,&Y));
   if (nc>0) {
@@ -176,8 +312,15 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
 
     /* 7. Compute residuals */
     ini = (ctx->lock)? nconv: 0;
+    if (nref>=LOBPCG_REFRESH) {  /* refresh needed */
+      PetscCall(BVMatMult(X,A,AX));
+      if (B) PetscCall(BVMatMult(X,B,BX));
+      nref = 0;
+    } else if (nref<0) {  /* AX has just been computed, BX not available */
+      if (B) PetscCall(BVMatMult(X,B,BX));
+      nref = 0;
+    }
     PetscCall(BVCopy(AX,R));
-    if (B) PetscCall(BVMatMult(X,B,BX));
     for (j=ini;j<ctx->bs;j++) {
       PetscCall(BVGetColumn(R,j,&v));
       PetscCall(BVGetColumn(B?BX:X,j,&z));
@@ -186,15 +329,16 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
       PetscCall(BVRestoreColumn(B?BX:X,j,&z));
     }
 
-    /* 8. Compute residual norms and update index set of active iterates */
+    /* 8. Compute residual norms (with a single reduction) and update index set of active iterates */
+    PetscCall(BVSetActiveColumns(R,ini,ctx->bs));
+    PetscCall(BVGetMat(R,&M));
+    PetscCall(MatGetColumnNorms(M,NORM_2,rnorm));
+    PetscCall(BVRestoreMat(R,&M));
     k = ini;
     countc = PETSC_TRUE;
     for (j=ini;j<ctx->bs;j++) {
       i = locked+j;
-      PetscCall(BVGetColumn(R,j,&v));
-      PetscCall(VecNorm(v,NORM_2,&norm));
-      PetscCall(BVRestoreColumn(R,j,&v));
-      PetscCall((*eps->converged)(eps,eps->eigr[i],eps->eigi[i],norm,&eps->errest[i],eps->convergedctx));
+      PetscCall((*eps->converged)(eps,eps->eigr[i],eps->eigi[i],rnorm[j-ini],&eps->errest[i],eps->convergedctx));
       if (countc) {
         if (eps->errest[i] < eps->tol) k++;
         else countc = PETSC_FALSE;
@@ -250,6 +394,7 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
       }
       locked += nconv;
       nconv = 0;
+      nref = -1;
       PetscCall(BVSetActiveColumns(X,nconv,ctx->bs));
 
       /* B-orthogonalize initial vectors */
@@ -327,71 +472,106 @@ static PetscErrorCode EPSSolve_LOBPCG(EPS eps)
     PetscCall(MatCopy(W,V,SAME_NONZERO_PATTERN));
     PetscCall(BVRestoreMat(R,&V));
 
-    /* 11. B-orthonormalize preconditioned residuals */
-    PetscCall(BVOrthogonalize(R,NULL));
-
-    /* 13-16. B-orthonormalize conjugate directions */
-    if (its>1) PetscCall(BVOrthogonalize(P,NULL));
-
-    /* 17-23. Compute symmetric Gram matrices */
-    PetscCall(BVSetActiveColumns(Z,0,ctx->bs));
-    PetscCall(BVSetActiveColumns(X,0,ctx->bs));
-    PetscCall(BVCopy(X,Z));
-    PetscCall(BVSetActiveColumns(Z,ctx->bs,2*ctx->bs-ini));
-    PetscCall(BVCopy(R,Z));
-    if (its>1) {
-      PetscCall(BVSetActiveColumns(Z,2*ctx->bs-ini,3*ctx->bs-2*ini));
-      PetscCall(BVCopy(P,Z));
+    /* 10. Compute the images of the preconditioned residuals; neither R nor P are
+           B-orthonormalized, the Gram matrices are stabilized in the small problem */
+    PetscCall(BVSetActiveColumns(AR,ini,ctx->bs));
+    PetscCall(BVMatMult(R,A,AR));
+    if (B) {
+      PetscCall(BVSetActiveColumns(BR,ini,ctx->bs));
+      PetscCall(BVMatMult(R,B,BR));
     }
 
+    /* 17-23. Compute symmetric Gram matrices [X R P]'*[AX AR AP BX BR BP] */
     if (its>1) nv = 3*ctx->bs-2*ini;
     else nv = 2*ctx->bs-ini;
-
+    PetscCall(BVSetActiveColumns(X,0,ctx->bs));
+    PetscCall(BVSetActiveColumns(AX,0,ctx->bs));
+    PetscCall(EPSLOBPCGCopyBlock(X,Z,0));
+    PetscCall(EPSLOBPCGCopyBlock(R,Z,ctx->bs));
+    PetscCall(EPSLOBPCGCopyBlock(AX,Q,0));
+    PetscCall(EPSLOBPCGCopyBlock(AR,Q,ctx->bs));
+    if (B) {
+      PetscCall(BVSetActiveColumns(BX,0,ctx->bs));
+      PetscCall(EPSLOBPCGCopyBlock(BX,Q,3*ctx->bs));
+      PetscCall(EPSLOBPCGCopyBlock(BR,Q,4*ctx->bs));
+    } else {
+      PetscCall(EPSLOBPCGCopyBlock(X,Q,3*ctx->bs));
+      PetscCall(EPSLOBPCGCopyBlock(R,Q,4*ctx->bs));
+    }
+    if (its>1) {
+      PetscCall(BVSetActiveColumns(P,ini,ctx->bs));
+      PetscCall(BVSetActiveColumns(AP,ini,ctx->bs));
+      PetscCall(EPSLOBPCGCopyBlock(P,Z,2*ctx->bs-ini));
+      PetscCall(EPSLOBPCGCopyBlock(AP,Q,2*ctx->bs-ini));
+      if (B) {
+        PetscCall(BVSetActiveColumns(BP,ini,ctx->bs));
+        PetscCall(EPSLOBPCGCopyBlock(BP,Q,5*ctx->bs-ini));
+      } else PetscCall(EPSLOBPCGCopyBlock(P,Q,5*ctx->bs-ini));
+    }
     PetscCall(BVSetActiveColumns(Z,0,nv));
-    PetscCall(DSSetDimensions(eps->ds,nv,0,0));
-    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&M));
-    PetscCall(BVMatProject(Z,A,Z,M));
-    if (flip) PetscCall(MatScale(M,-1.0));
-    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&M));
-    PetscCall(DSGetMat(eps->ds,DS_MAT_B,&M));
-    PetscCall(BVMatProject(Z,B,Z,M)); /* covers also the case B=NULL */
-    PetscCall(DSRestoreMat(eps->ds,DS_MAT_B,&M));
-
-    /* 24. Solve the generalized eigenvalue problem */
-    PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
-    PetscCall(DSSolve(eps->ds,eigr,NULL));
-    PetscCall(DSSort(eps->ds,eigr,NULL,NULL,NULL,NULL));
-    PetscCall(DSSynchronize(eps->ds,eigr,NULL));
-    for (j=0;j<nv;j++) if (locked+j<eps->ncv) eps->eigr[locked+j] = flip? -eigr[j]: eigr[j];
-    PetscCall(DSVectors(eps->ds,DS_MAT_X,NULL,NULL));
+    PetscCall(BVSetActiveColumns(Q,0,3*ctx->bs+nv));
+    PetscCall(BVMatProject(Q,NULL,Z,G));
+
+    /* 24. Solve the projected eigenvalue problem */
+    PetscCall(EPSLOBPCGRayleighRitz(eps,G,nv,3*ctx->bs,flip,eigr,C,&r));
+    if (r<ctx->bs) {
+      PetscCall(PetscInfo(eps,"Rank deficiency of the Gram matrix, r=%" PetscInt_FMT "\n",r));
+      eps->reason = EPS_DIVERGED_BREAKDOWN;
+      goto diverged;
+    }
+    for (j=0;j<r;j++) if (locked+j<eps->ncv) eps->eigr[locked+j] = flip? -eigr[j]: eigr[j];
 
-    /* 25-33. Compute Ritz vectors */
-    PetscCall(DSGetMat(eps->ds,DS_MAT_X,&M));
+    /* 25-33. Compute Ritz vectors, P = [R P]*C(bs:nv,:) and X = X*C(0:bs,:) + P,
+              together with their images, without additional products with A or B */
+    PetscCall(BVSetActiveColumns(P,0,ctx->bs));
+    PetscCall(BVSetActiveColumns(AP,0,ctx->bs));
     PetscCall(BVSetActiveColumns(Z,ctx->bs,nv));
-    if (ctx->lock) PetscCall(BVSetActiveColumns(P,0,ctx->bs));
-    PetscCall(BVMult(P,1.0,0.0,Z,M));
+    PetscCall(BVMult(P,1.0,0.0,Z,C));
+    PetscCall(BVSetActiveColumns(Q,ctx->bs,nv));
+    PetscCall(BVMult(AP,1.0,0.0,Q,C));
     PetscCall(BVCopy(P,X));
-    if (ctx->lock) PetscCall(BVSetActiveColumns(P,nconv,ctx->bs));
+    PetscCall(BVCopy(AP,AX));
     PetscCall(BVSetActiveColumns(Z,0,ctx->bs));
-    PetscCall(BVMult(X,1.0,1.0,Z,M));
-    if (ctx->lock) PetscCall(BVSetActiveColumns(X,nconv,ctx->bs));
-    PetscCall(BVMatMult(X,A,AX));
-    PetscCall(DSRestoreMat(eps->ds,DS_MAT_X,&M));
+    PetscCall(BVMult(X,1.0,1.0,Z,C));
+    PetscCall(BVSetActiveColumns(Q,0,ctx->bs));
+    PetscCall(BVMult(AX,1.0,1.0,Q,C));
+    if (B) {
+      PetscCall(BVSetActiveColumns(BP,0,ctx->bs));
+      PetscCall(BVSetActiveColumns(Q,4*ctx->bs,3*ctx->bs+nv));
+      PetscCall(BVMult(BP,1.0,0.0,Q,C));
+      PetscCall(BVCopy(BP,BX));
+      PetscCall(BVSetActiveColumns(Q,3*ctx->bs,4*ctx->bs));
+      PetscCall(BVMult(BX,1.0,1.0,Q,C));
+    }
+    nref++;
+    if (ctx->lock) {
+      PetscCall(BVSetActiveColumns(P,nconv,ctx->bs));
+      PetscCall(BVSetActiveColumns(X,nconv,ctx->bs));
+    }
   }
 
 diverged:
   eps->its += its;
 
   if (flip) sc->comparison = SlepcCompareLargestReal;
-  PetscCall(PetscFree(eigr));
+  PetscCall(PetscFree2(eigr,rnorm));
   PetscCall(MatDestroy(&W));
+  PetscCall(MatDestroy(&G));
+  PetscCall(MatDestroy(&C));
   if (V) PetscCall(BVRestoreMat(R,&V)); /* only needed when goto diverged is reached */
   PetscCall(BVDestroy(&Z));
   PetscCall(BVDestroy(&X));
   PetscCall(BVDestroy(&R));
   PetscCall(BVDestroy(&P));
   PetscCall(BVDestroy(&AX));
-  if (B) PetscCall(BVDestroy(&BX));
+  PetscCall(BVDestroy(&AR));
+  PetscCall(BVDestroy(&AP));
+  if (B) {
+    PetscCall(BVDestroy(&BX));
+    PetscCall(BVDestroy(&BR));
+    PetscCall(BVDestroy(&BP));
+  }
+  PetscCall(BVDestroy(&Q));
   if (nc>0 || eps->nev>ctx->bs-ctx->guard) PetscCall(BVDestroy(&Y));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -22,16 +22,22 @@
        [1] L. Bergamaschi et al., "Parallel preconditioned conjugate gradient
            optimization of the Rayleigh quotient for the solution of sparse
            eigenproblems", Appl. Math. Comput. 175(2):1694-1715, 2006.
+
+   The block variant performs the line searches of all active vectors at
+   once, packing the inner products into a single reduction per step and
+   applying the preconditioner to all gradients together.
 */
 
 #include <slepc/private/epsimpl.h>                /*I "slepceps.h" I*/
 
 static PetscErrorCode EPSSolve_RQCG(EPS);
+static PetscErrorCode EPSSolve_RQCG_Block(EPS);
 
 typedef struct {
-  PetscInt nrest;         /* user-provided reset parameter */
-  PetscInt allocsize;     /* number of columns of work BV's allocated at setup */
-  BV       AV,W,P,G;
+  PetscInt  nrest;        /* user-provided reset parameter */
+  PetscInt  allocsize;    /* number of columns of work BV's allocated at setup */
+  PetscBool block;        /* block variant with packed reductions */
+  BV        AV,W,P,G,Z;
 } EPS_RQCG;
 
 static PetscErrorCode EPSSetUp_RQCG(EPS eps)
@@ -67,21 +73,72 @@ static PetscErrorCode EPSSetUp_RQCG(EPS eps)
     if (nmat>1) PetscCall(BVResize(ctx->W,eps->mpd,PETSC_FALSE));
     PetscCall(BVResize(ctx->P,eps->mpd,PETSC_FALSE));
     PetscCall(BVResize(ctx->G,eps->mpd,PETSC_FALSE));
+    if (ctx->Z) PetscCall(BVResize(ctx->Z,eps->mpd,PETSC_FALSE));
   }
+  if (ctx->block && !ctx->Z) PetscCall(BVDuplicate(ctx->AV,&ctx->Z));
   PetscCall(DSSetType(eps->ds,DSHEP));
   PetscCall(DSAllocate(eps->ds,eps->ncv));
   PetscCall(EPSSetWorkVecs(eps,1));
+  eps->ops->solve = ctx->block? EPSSolve_RQCG_Block: EPSSolve_RQCG;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Rayleigh-Ritz step on the active columns V(:,nconv:nv), updating also AV = A*V
+*/
+static PetscErrorCode EPSRQCGRayleighRitz(EPS eps,Mat A,Mat B,PetscInt nv)
+{
+  EPS_RQCG       *ctx = (EPS_RQCG*)eps->data;
+  PetscInt       i,j,ld;
+  PetscScalar    *C;
+  Mat            Q,Q1;
+  Vec            av;
+
+  PetscFunctionBegin;
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+
+  /* Prevent BVDotVec below to use B-product, restored at the end */
+  PetscCall(BVSetMatrix(eps->V,NULL,PETSC_FALSE));
+
+  /* Compute Rayleigh quotient */
+  PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+  PetscCall(BVSetActiveColumns(ctx->AV,0,nv-eps->nconv));
+  PetscCall(BVMatMult(eps->V,A,ctx->AV));
+  PetscCall(DSGetArray(eps->ds,DS_MAT_A,&C));
+  for (i=eps->nconv;i<nv;i++) {
+    PetscCall(BVSetActiveColumns(eps->V,eps->nconv,i+1));
+    PetscCall(BVGetColumn(ctx->AV,i-eps->nconv,&av));
+    PetscCall(BVDotVec(eps->V,av,C+eps->nconv+i*ld));
+    PetscCall(BVRestoreColumn(ctx->AV,i-eps->nconv,&av));
+    for (j=eps->nconv;j<i-1;j++) C[i+j*ld] = PetscConj(C[j+i*ld]);
+  }
+  PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&C));
+  PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+
+  /* Solve projected problem */
+  PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
+  PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+  PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
+
+  /* Update vectors V(:,idx) = V * Y(:,idx) */
+  PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
+  PetscCall(BVMultInPlace(eps->V,Q,eps->nconv,nv));
+  PetscCall(MatDenseGetSubMatrix(Q,eps->nconv,PETSC_DECIDE,eps->nconv,PETSC_DECIDE,&Q1));
+  PetscCall(BVMultInPlace(ctx->AV,Q1,0,nv-eps->nconv));
+  PetscCall(MatDenseRestoreSubMatrix(Q,&Q1));
+  PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&Q));
+  if (B) PetscCall(BVSetMatrix(eps->V,B,PETSC_FALSE));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode EPSSolve_RQCG(EPS eps)
 {
   EPS_RQCG       *ctx = (EPS_RQCG*)eps->data;
-  PetscInt       i,j,k,ld,nv,ncv = eps->ncv,kini,nmat;
+  PetscInt       i,k,ld,nv,ncv = eps->ncv,kini,nmat;
   PetscScalar    *C,*gamma,g,pap,pbp,pbx,pax,nu,mu,alpha,beta;
   PetscReal      resnorm,a,b,c,d,disc,t;
   PetscBool      reset;
-  Mat            A,B,Q,Q1;
+  Mat            A,B;
   Vec            v,av,bv,p,w=eps->work[0];
 
   PetscFunctionBegin;
@@ -103,39 +160,8 @@ static PetscErrorCode EPSSolve_RQCG(EPS eps)
     }
     reset = (eps->its>1 && (eps->its-1)%ctx->nrest==0)? PETSC_TRUE: PETSC_FALSE;
 
-    if (reset) {
-      /* Prevent BVDotVec below to use B-product, restored at the end */
-      PetscCall(BVSetMatrix(eps->V,NULL,PETSC_FALSE));
-
-      /* Compute Rayleigh quotient */
-      PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
-      PetscCall(BVSetActiveColumns(ctx->AV,0,nv-eps->nconv));
-      PetscCall(BVMatMult(eps->V,A,ctx->AV));
-      PetscCall(DSGetArray(eps->ds,DS_MAT_A,&C));
-      for (i=eps->nconv;i<nv;i++) {
-        PetscCall(BVSetActiveColumns(eps->V,eps->nconv,i+1));
-        PetscCall(BVGetColumn(ctx->AV,i-eps->nconv,&av));
-        PetscCall(BVDotVec(eps->V,av,C+eps->nconv+i*ld));
-        PetscCall(BVRestoreColumn(ctx->AV,i-eps->nconv,&av));
-        for (j=eps->nconv;j<i-1;j++) C[i+j*ld] = PetscConj(C[j+i*ld]);
-      }
-      PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&C));
-      PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
-
-      /* Solve projected problem */
-      PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
-      PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
-      PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
-
-      /* Update vectors V(:,idx) = V * Y(:,idx) */
-      PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
-      PetscCall(BVMultInPlace(eps->V,Q,eps->nconv,nv));
-      PetscCall(MatDenseGetSubMatrix(Q,eps->nconv,PETSC_DECIDE,eps->nconv,PETSC_DECIDE,&Q1));
-      PetscCall(BVMultInPlace(ctx->AV,Q1,0,nv-eps->nconv));
-      PetscCall(MatDenseRestoreSubMatrix(Q,&Q1));
-      PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&Q));
-      if (B) PetscCall(BVSetMatrix(eps->V,B,PETSC_FALSE));
-    } else {
+    if (reset) PetscCall(EPSRQCGRayleighRitz(eps,A,B,nv));
+    else {
       /* No need to do Rayleigh-Ritz, just take diag(V'*A*V) */
       for (i=eps->nconv;i<nv;i++) {
         PetscCall(BVGetColumn(eps->V,i,&v));
@@ -241,6 +267,230 @@ static PetscErrorCode EPSSolve_RQCG(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Block variant: same iteration as EPSSolve_RQCG(), but each step is done for all
+   active columns at once, with the inner products of the step packed into a single
+   split-phase reduction, and the preconditioner applied to all gradients together
+*/
+static PetscErrorCode EPSSolve_RQCG_Block(EPS eps)
+{
+  EPS_RQCG       *ctx = (EPS_RQCG*)eps->data;
+  PetscInt       i,j,k,ld,nv,m,nc,ncv = eps->ncv,kini,nmat;
+  PetscScalar    *C,*gamma,*g,*dots,*pM,alpha,beta;
+  PetscReal      *resnorm,a,b,c,d,disc,t;
+  PetscBool      reset,isprecond;
+  Mat            A,B,M,Gm,Zm;
+  Vec            v,av,bv,p,z,bp;
+
+  PetscFunctionBegin;
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  PetscCall(STGetNumMatrices(eps->st,&nmat));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  if (nmat>1) PetscCall(STGetMatrix(eps->st,1,&B));
+  else B = NULL;
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STPRECOND,&isprecond));
+  PetscCall(PetscMalloc4(eps->mpd,&gamma,eps->mpd,&g,6*eps->mpd,&dots,eps->mpd,&resnorm));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ncv,eps->mpd,NULL,&M));
+
+  kini = eps->nini;
+  while (eps->reason == EPS_CONVERGED_ITERATING) {
+    eps->its++;
+    nc = eps->nconv;
+    nv = PetscMin(nc+eps->mpd,ncv);
+    m  = nv-nc;
+    PetscCall(DSSetDimensions(eps->ds,nv,nc,0));
+    for (;kini<nv;kini++) { /* Generate more initial vectors if necessary */
+      PetscCall(BVSetRandomColumn(eps->V,kini));
+      PetscCall(BVOrthonormalizeColumn(eps->V,kini,PETSC_TRUE,NULL,NULL));
+    }
+    reset = (eps->its>1 && (eps->its-1)%ctx->nrest==0)? PETSC_TRUE: PETSC_FALSE;
+
+    if (reset) PetscCall(EPSRQCGRayleighRitz(eps,A,B,nv));
+    PetscCall(BVSetActiveColumns(eps->V,nc,nv));
+    PetscCall(BVSetActiveColumns(ctx->AV,0,m));
+    PetscCall(BVSetActiveColumns(ctx->P,0,m));
+    PetscCall(BVSetActiveColumns(ctx->G,0,m));
+    PetscCall(BVSetActiveColumns(ctx->Z,0,m));
+    if (B) PetscCall(BVSetActiveColumns(ctx->W,0,m));
+    if (!reset) {
+      /* No need to do Rayleigh-Ritz, just take diag(V'*A*V) */
+      PetscCall(BVMatMult(eps->V,A,ctx->AV));
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(eps->V,nc+i,&v));
+        PetscCall(BVGetColumn(ctx->AV,i,&av));
+        PetscCall(VecDotBegin(av,v,eps->eigr+nc+i));
+        PetscCall(BVRestoreColumn(eps->V,nc+i,&v));
+        PetscCall(BVRestoreColumn(ctx->AV,i,&av));
+      }
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(eps->V,nc+i,&v));
+        PetscCall(BVGetColumn(ctx->AV,i,&av));
+        PetscCall(VecDotEnd(av,v,eps->eigr+nc+i));
+        PetscCall(BVRestoreColumn(eps->V,nc+i,&v));
+        PetscCall(BVRestoreColumn(ctx->AV,i,&av));
+      }
+    }
+
+    /* Compute gradient G = A*V-B*V*diag(eigr) and check convergence */
+    if (B) PetscCall(BVMatMult(eps->V,B,ctx->W));
+    PetscCall(BVCopy(ctx->AV,ctx->G));
+    for (i=0;i<m;i++) {
+      PetscCall(BVGetColumn(ctx->G,i,&p));
+      if (B) PetscCall(BVGetColumn(ctx->W,i,&bv));
+      else PetscCall(BVGetColumn(eps->V,nc+i,&bv));
+      PetscCall(VecAXPY(p,-eps->eigr[nc+i],bv));
+      if (B) PetscCall(BVRestoreColumn(ctx->W,i,&bv));
+      else PetscCall(BVRestoreColumn(eps->V,nc+i,&bv));
+      PetscCall(VecNormBegin(p,NORM_2,resnorm+i));
+      PetscCall(BVRestoreColumn(ctx->G,i,&p));
+    }
+    for (i=0;i<m;i++) {
+      PetscCall(BVGetColumn(ctx->G,i,&p));
+      PetscCall(VecNormEnd(p,NORM_2,resnorm+i));
+      PetscCall(BVRestoreColumn(ctx->G,i,&p));
+    }
+    k = -1;
+    for (i=nc;i<nv;i++) {
+      PetscCall((*eps->converged)(eps,eps->eigr[i],0.0,resnorm[i-nc],&eps->errest[i],eps->convergedctx));
+      if (k==-1 && eps->errest[i] >= eps->tol) k = i;
+    }
+    if (k==-1) k = nv;
+    PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,k,eps->nev,&eps->reason,eps->stoppingctx));
+
+    /* The next lines are necessary to avoid DS zeroing eigr */
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&C));
+    for (i=nc;i<k;i++) C[i+i*ld] = eps->eigr[i];
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&C));
+
+    if (eps->reason == EPS_CONVERGED_ITERATING) {
+
+      /* Preconditioned gradients Z = K\G */
+      if (isprecond) {
+        PetscCall(BVGetMat(ctx->G,&Gm));
+        PetscCall(BVGetMat(ctx->Z,&Zm));
+        PetscCall(STApplyMat(eps->st,Gm,Zm));
+        PetscCall(BVRestoreMat(ctx->Z,&Zm));
+        PetscCall(BVRestoreMat(ctx->G,&Gm));
+      } else {
+        for (i=0;i<m;i++) {
+          PetscCall(BVGetColumn(ctx->G,i,&p));
+          PetscCall(BVGetColumn(ctx->Z,i,&z));
+          PetscCall(STApply(eps->st,p,z));
+          PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+          PetscCall(BVRestoreColumn(ctx->G,i,&p));
+        }
+      }
+
+      /* Search directions P = Z + beta*P */
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(ctx->G,i,&p));
+        PetscCall(BVGetColumn(ctx->Z,i,&z));
+        PetscCall(VecDotBegin(z,p,g+i));
+        PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+        PetscCall(BVRestoreColumn(ctx->G,i,&p));
+      }
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(ctx->G,i,&p));
+        PetscCall(BVGetColumn(ctx->Z,i,&z));
+        PetscCall(VecDotEnd(z,p,g+i));
+        PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+        PetscCall(BVRestoreColumn(ctx->G,i,&p));
+        beta = (!reset && eps->its>1)? g[i]/gamma[i]: 0.0;
+        gamma[i] = g[i];
+        PetscCall(BVGetColumn(ctx->P,i,&p));
+        PetscCall(BVGetColumn(ctx->Z,i,&z));
+        PetscCall(VecAXPBY(p,1.0,beta,z));
+        PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+        PetscCall(BVRestoreColumn(ctx->P,i,&p));
+      }
+
+      /* Orthogonalize P(:,i) against V(:,0:nc+i) with two passes of block classical Gram-Schmidt */
+      PetscCall(BVSetActiveColumns(eps->V,0,nv));
+      for (j=0;j<2;j++) {
+        PetscCall(BVDot(ctx->P,eps->V,M));
+        PetscCall(MatDenseGetArray(M,&pM));
+        for (i=0;i<m;i++) PetscCall(PetscArrayzero(pM+nc+i+i*ncv,m-i));
+        PetscCall(MatDenseRestoreArray(M,&pM));
+        PetscCall(BVMult(ctx->P,-1.0,1.0,eps->V,M));
+      }
+
+      /* Minimization problem, with all the inner products in one reduction */
+      PetscCall(BVMatMult(ctx->P,A,ctx->Z));
+      if (B) PetscCall(BVMatMult(ctx->P,B,ctx->G));
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(eps->V,nc+i,&v));
+        PetscCall(BVGetColumn(ctx->AV,i,&av));
+        PetscCall(BVGetColumn(ctx->P,i,&p));
+        PetscCall(BVGetColumn(ctx->Z,i,&z));
+        if (B) {
+          PetscCall(BVGetColumn(ctx->W,i,&bv));
+          PetscCall(BVGetColumn(ctx->G,i,&bp));
+        } else { bv = v; bp = p; }
+        PetscCall(VecDotBegin(av,v,dots+6*i));     /* nu  */
+        PetscCall(VecDotBegin(av,p,dots+6*i+1));   /* pax */
+        PetscCall(VecDotBegin(z,p,dots+6*i+2));    /* pap */
+        PetscCall(VecDotBegin(bv,v,dots+6*i+3));   /* mu  */
+        PetscCall(VecDotBegin(bv,p,dots+6*i+4));   /* pbx */
+        PetscCall(VecDotBegin(bp,p,dots+6*i+5));   /* pbp */
+        if (B) {
+          PetscCall(BVRestoreColumn(ctx->G,i,&bp));
+          PetscCall(BVRestoreColumn(ctx->W,i,&bv));
+        }
+        PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+        PetscCall(BVRestoreColumn(ctx->P,i,&p));
+        PetscCall(BVRestoreColumn(ctx->AV,i,&av));
+        PetscCall(BVRestoreColumn(eps->V,nc+i,&v));
+      }
+      for (i=0;i<m;i++) {
+        PetscCall(BVGetColumn(eps->V,nc+i,&v));
+        PetscCall(BVGetColumn(ctx->AV,i,&av));
+        PetscCall(BVGetColumn(ctx->P,i,&p));
+        PetscCall(BVGetColumn(ctx->Z,i,&z));
+        if (B) {
+          PetscCall(BVGetColumn(ctx->W,i,&bv));
+          PetscCall(BVGetColumn(ctx->G,i,&bp));
+        } else { bv = v; bp = p; }
+        PetscCall(VecDotEnd(av,v,dots+6*i));
+        PetscCall(VecDotEnd(av,p,dots+6*i+1));
+        PetscCall(VecDotEnd(z,p,dots+6*i+2));
+        PetscCall(VecDotEnd(bv,v,dots+6*i+3));
+        PetscCall(VecDotEnd(bv,p,dots+6*i+4));
+        PetscCall(VecDotEnd(bp,p,dots+6*i+5));
+        if (B) {
+          PetscCall(BVRestoreColumn(ctx->G,i,&bp));
+          PetscCall(BVRestoreColumn(ctx->W,i,&bv));
+        }
+        PetscCall(BVRestoreColumn(ctx->Z,i,&z));
+        PetscCall(BVRestoreColumn(ctx->AV,i,&av));
+        /* dots = [nu pax pap mu pbx pbp] */
+        a = PetscRealPart(dots[6*i+2]*dots[6*i+4]-dots[6*i+1]*dots[6*i+5]);
+        b = PetscRealPart(dots[6*i]*dots[6*i+5]-dots[6*i+3]*dots[6*i+2]);
+        c = PetscRealPart(dots[6*i+3]*dots[6*i+1]-dots[6*i]*dots[6*i+4]);
+        t = PetscMax(PetscMax(PetscAbsReal(a),PetscAbsReal(b)),PetscAbsReal(c));
+        if (t!=0.0) { a /= t; b /= t; c /= t; }
+        disc = b*b-4.0*a*c;
+        d = PetscSqrtReal(PetscAbsReal(disc));
+        if (b>=0.0 && a!=0.0) alpha = (b+d)/(2.0*a);
+        else if (b!=d) alpha = 2.0*c/(b-d);
+        else alpha = 0;
+        /* Next iterate */
+        if (alpha!=0.0) PetscCall(VecAXPY(v,alpha,p));
+        PetscCall(BVRestoreColumn(ctx->P,i,&p));
+        PetscCall(BVRestoreColumn(eps->V,nc+i,&v));
+      }
+      PetscCall(BVSetActiveColumns(eps->V,nc,nv));
+      PetscCall(BVOrthogonalize(eps->V,NULL));
+    }
+
+    PetscCall(EPSMonitor(eps,eps->its,k,eps->eigr,eps->eigi,eps->errest,nv));
+    eps->nconv = k;
+  }
+
+  PetscCall(MatDestroy(&M));
+  PetscCall(PetscFree4(gamma,g,dots,resnorm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSRQCGSetReset_RQCG(EPS eps,PetscInt nrest)
 {
   EPS_RQCG *ctx = (EPS_RQCG*)eps->data;
@@ -315,6 +565,89 @@ PetscErrorCode EPSRQCGGetReset(EPS eps,PetscInt *nrest)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSRQCGSetBlock_RQCG(EPS eps,PetscBool block)
+{
+  EPS_RQCG *ctx = (EPS_RQCG*)eps->data;
+
+  PetscFunctionBegin;
+  if (ctx->block != block) {
+    ctx->block = block;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSRQCGSetBlock - Activates the block variant of the RQCG iteration, in which
+   the line searches of all the active vectors are carried out together.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  block - whether the block variant is used
+
+   Options Database Key:
+.  -eps_rqcg_block - Activates the block variant
+
+   Notes:
+   In the default variant, each vector is updated separately, so every iteration
+   requires a number of global reductions proportional to the number of vectors.
+   In the block variant, the operators and the preconditioner are applied to all
+   vectors at once (with MatProduct and PCMatApply, when supported), and the inner
+   products of each step are packed into a single reduction, which reduces the
+   communication latency when many eigenpairs are requested.
+
+   The final orthonormalization of the updated vectors is done with BVOrthogonalize(),
+   so a block orthogonalization method can be selected with BVSetOrthogonalization().
+
+   Level: advanced
+
+.seealso: EPSRQCGGetBlock()
+@*/
+PetscErrorCode EPSRQCGSetBlock(EPS eps,PetscBool block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,block,2);
+  PetscTryMethod(eps,"EPSRQCGSetBlock_C",(EPS,PetscBool),(eps,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSRQCGGetBlock_RQCG(EPS eps,PetscBool *block)
+{
+  EPS_RQCG *ctx = (EPS_RQCG*)eps->data;
+
+  PetscFunctionBegin;
+  *block = ctx->block;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSRQCGGetBlock - Gets the flag indicating whether the block variant of the
+   RQCG iteration is used.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  block - the flag
+
+   Level: advanced
+
+.seealso: EPSRQCGSetBlock()
+@*/
+PetscErrorCode EPSRQCGGetBlock(EPS eps,PetscBool *block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(block,2);
+  PetscUseMethod(eps,"EPSRQCGGetBlock_C",(EPS,PetscBool*),(eps,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSReset_RQCG(EPS eps)
 {
   EPS_RQCG       *ctx = (EPS_RQCG*)eps->data;
@@ -324,13 +657,14 @@ static PetscErrorCode EPSReset_RQCG(EPS eps)
   PetscCall(BVDestroy(&ctx->W));
   PetscCall(BVDestroy(&ctx->P));
   PetscCall(BVDestroy(&ctx->G));
+  PetscCall(BVDestroy(&ctx->Z));
   ctx->allocsize = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode EPSSetFromOptions_RQCG(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
-  PetscBool      flg;
+  PetscBool      flg,block;
   PetscInt       nrest;
 
   PetscFunctionBegin;
@@ -339,6 +673,9 @@ static PetscErrorCode EPSSetFromOptions_RQCG(EPS eps,PetscOptionItems *PetscOpti
     PetscCall(PetscOptionsInt("-eps_rqcg_reset","Reset parameter","EPSRQCGSetReset",20,&nrest,&flg));
     if (flg) PetscCall(EPSRQCGSetReset(eps,nrest));
 
+    PetscCall(PetscOptionsBool("-eps_rqcg_block","Use the block variant with packed reductions","EPSRQCGSetBlock",PETSC_FALSE,&block,&flg));
+    if (flg) PetscCall(EPSRQCGSetBlock(eps,block));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -349,6 +686,8 @@ static PetscErrorCode EPSDestroy_RQCG(EPS eps)
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGSetReset_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGGetReset_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGSetBlock_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGGetBlock_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -359,7 +698,10 @@ static PetscErrorCode EPSView_RQCG(EPS eps,PetscViewer viewer)
 
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
-  if (isascii) PetscCall(PetscViewerASCIIPrintf(viewer,"  reset every %" PetscInt_FMT " iterations\n",ctx->nrest));
+  if (isascii) {
+    PetscCall(PetscViewerASCIIPrintf(viewer,"  reset every %" PetscInt_FMT " iterations\n",ctx->nrest));
+    if (ctx->block) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the block variant with packed reductions\n"));
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -386,5 +728,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_RQCG(EPS eps)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGSetReset_C",EPSRQCGSetReset_RQCG));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGGetReset_C",EPSRQCGGetReset_RQCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGSetBlock_C",EPSRQCGSetBlock_RQCG));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSRQCGGetBlock_C",EPSRQCGGetBlock_RQCG));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -453,33 +453,44 @@ static PetscErrorCode EPSXDComputeDSConv(dvdDashboard *d)
 
 /*
    Compute the residual vectors R(i) <- (AV - BV*eigr(i))*pX(i), and also
-   the norm associated to the Schur pair, where i = r_s..r_e
+   the norm associated to the Schur pair, where i = r_s..r_e. The residuals
+   are formed in d->auxBV as a block, R <- AV*pX - BV*pX*diag(eigr), and each
+   column is then projected in place with d->calcpairs_proj_res
 */
 static PetscErrorCode dvd_calcpairs_res_0(dvdDashboard *d,PetscInt r_s,PetscInt r_e)
 {
   PetscInt       i,ldpX;
-  PetscScalar    *pX;
+  PetscScalar    *pX,*s;
   BV             BX = d->BX?d->BX:d->eps->V;
-  Vec            *R;
+  Vec            R;
 
   PetscFunctionBegin;
+  if (r_e <= r_s) PetscFunctionReturn(PETSC_SUCCESS);
   PetscCall(DSGetLeadingDimension(d->eps->ds,&ldpX));
   PetscCall(DSGetArray(d->eps->ds,DS_MAT_Q,&pX));
   /* nX(i) <- ||X(i)|| */
   PetscCall(dvd_improvex_compute_X(d,r_s,r_e,NULL,pX,ldpX));
-  PetscCall(SlepcVecPoolGetVecs(d->auxV,r_e-r_s,&R));
+  /* R <- AV*pX */
+  PetscCall(dvd_mult_pX(d->auxBV,1.0,0.0,d->AX,pX,ldpX,r_s,r_e,NULL));
+  /* R <- R - BV*pX*diag(eigr) */
+  PetscCall(PetscMalloc1(r_e,&s));
+  for (i=r_s;i<r_e;i++) s[i] = -d->eigr[i];
+  PetscCall(dvd_mult_pX(d->auxBV,1.0,1.0,BX,pX,ldpX,r_s,r_e,s));
+  PetscCall(PetscFree(s));
+  PetscCall(DSRestoreArray(d->eps->ds,DS_MAT_Q,&pX));
   for (i=r_s;i<r_e;i++) {
-    /* R(i-r_s) <- AV*pX(i) */
-    PetscCall(BVMultVec(d->AX,1.0,0.0,R[i-r_s],&pX[ldpX*i]));
-    /* R(i-r_s) <- R(i-r_s) - eigr(i)*BX*pX(i) */
-    PetscCall(BVMultVec(BX,-d->eigr[i],1.0,R[i-r_s],&pX[ldpX*i]));
+    PetscCall(BVGetColumn(d->auxBV,i-r_s,&R));
+    PetscCall(d->calcpairs_proj_res(d,i,i+1,&R));
+    PetscCall(BVRestoreColumn(d->auxBV,i-r_s,&R));
   }
-  PetscCall(DSRestoreArray(d->eps->ds,DS_MAT_Q,&pX));
-  PetscCall(d->calcpairs_proj_res(d,r_s,r_e,R));
-  PetscCall(SlepcVecPoolRestoreVecs(d->auxV,r_e-r_s,&R));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Orthogonalize the residuals R(0:r_e-r_s-1) against cX(:,0:l-1) with BVOrthogonalizeVec(),
+   which follows the orthogonalization settings of cX, and compute the norms
+   nR[i] <- ||R(i-r_s)||
+*/
 static PetscErrorCode dvd_calcpairs_proj_res(dvdDashboard *d,PetscInt r_s,PetscInt r_e,Vec *R)
 {
   PetscInt       i,l,k;
@@ -494,9 +505,11 @@ static PetscErrorCode dvd_calcpairs_proj_res(dvdDashboard *d,PetscInt r_s,PetscI
   if (cX) {
     PetscCall(BVGetActiveColumns(cX,&l,&k));
     PetscCall(BVSetActiveColumns(cX,0,l));
-    for (i=0;i<r_e-r_s;i++) PetscCall(BVOrthogonalizeVec(cX,R[i],NULL,&d->nR[r_s+i],&lindep));
+    for (i=0;i<r_e-r_s;i++) {
+      PetscCall(BVOrthogonalizeVec(cX,R[i],NULL,&d->nR[r_s+i],&lindep));
+      if (lindep || (PetscAbs(d->nR[r_s+i]) < PETSC_MACHINE_EPSILON)) PetscCall(PetscInfo(d->eps,"The computed eigenvector residual %" PetscInt_FMT " is too low, %g!\n",r_s+i,(double)d->nR[r_s+i]));
+    }
     PetscCall(BVSetActiveColumns(cX,l,k));
-    if (lindep || (PetscAbs(d->nR[r_s+i]) < PETSC_MACHINE_EPSILON)) PetscCall(PetscInfo(d->eps,"The computed eigenvector residual %" PetscInt_FMT " is too low, %g!\n",r_s+i,(double)d->nR[r_s+i]));
   } else {
     for (i=0;i<r_e-r_s;i++) PetscCall(VecNormBegin(R[i],NORM_2,&d->nR[r_s+i]));
     for (i=0;i<r_e-r_s;i++) PetscCall(VecNormEnd(R[i],NORM_2,&d->nR[r_s+i]));
@@ -68,8 +68,9 @@ static PetscErrorCode dvd_improvex_apply_proj(dvdDashboard *d,Vec *V,PetscInt cV
   PetscCall(BVGetActiveColumns(data->U,&l,&k));
   PetscAssert(ldh==k,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
   PetscCall(BVSetActiveColumns(data->U,0,k));
+  for (i=0;i<cV;i++) PetscCall(BVDotVecBegin(data->U,V[i],&h[ldh*i]));
   for (i=0;i<cV;i++) {
-    PetscCall(BVDotVec(data->U,V[i],&h[ldh*i]));
+    PetscCall(BVDotVecEnd(data->U,V[i],&h[ldh*i]));
 #if defined(PETSC_USE_COMPLEX)
     for (j=0; j<k; j++) h[ldh*i+j] = PetscConj(h[ldh*i+j]);
 #endif
@@ -117,8 +118,9 @@ static PetscErrorCode dvd_improvex_applytrans_proj(dvdDashboard *d,Vec *V,PetscI
   PetscCall(BVGetActiveColumns(data->U,&l,&k));
   PetscAssert(ldh==k,PETSC_COMM_SELF,PETSC_ERR_PLIB,"Consistency broken");
   PetscCall(BVSetActiveColumns(data->KZ,0,k));
+  for (i=0;i<cV;i++) PetscCall(BVDotVecBegin(data->KZ,V[i],&h[ldh*i]));
   for (i=0;i<cV;i++) {
-    PetscCall(BVDotVec(data->KZ,V[i],&h[ldh*i]));
+    PetscCall(BVDotVecEnd(data->KZ,V[i],&h[ldh*i]));
 #if defined(PETSC_USE_COMPLEX)
     for (j=0;j<k;j++) h[ldh*i+j] = PetscConj(h[ldh*i+j]);
 #endif
@@ -986,18 +988,23 @@ PetscErrorCode dvd_improvex_jd_proj_uv(dvdDashboard *d,dvdBlackboard *b)
 PetscErrorCode dvd_improvex_compute_X(dvdDashboard *d,PetscInt i_s,PetscInt i_e,Vec *u_,PetscScalar *pX,PetscInt ld)
 {
   PetscInt       n = i_e - i_s,i;
-  Vec            *u;
 
   PetscFunctionBegin;
-  if (u_) u = u_;
-  else if (d->correctXnorm) PetscCall(SlepcVecPoolGetVecs(d->auxV,i_e-i_s,&u));
-  if (u_ || d->correctXnorm) {
-    for (i=0;i<n;i++) PetscCall(BVMultVec(d->eps->V,1.0,0.0,u[i],&pX[ld*(i+i_s)]));
+  if (u_) {
+    for (i=0;i<n;i++) PetscCall(BVMultVec(d->eps->V,1.0,0.0,u_[i],&pX[ld*(i+i_s)]));
+  } else if (d->correctXnorm) {
+    /* only the norms are needed, form the whole block in auxBV with a single product */
+    PetscCall(dvd_mult_pX(d->auxBV,1.0,0.0,d->eps->V,pX,ld,i_s,i_e,NULL));
   }
   /* nX(i) <- ||X(i)|| */
   if (d->correctXnorm) {
-    for (i=0;i<n;i++) PetscCall(VecNormBegin(u[i],NORM_2,&d->nX[i_s+i]));
-    for (i=0;i<n;i++) PetscCall(VecNormEnd(u[i],NORM_2,&d->nX[i_s+i]));
+    if (u_) {
+      for (i=0;i<n;i++) PetscCall(VecNormBegin(u_[i],NORM_2,&d->nX[i_s+i]));
+      for (i=0;i<n;i++) PetscCall(VecNormEnd(u_[i],NORM_2,&d->nX[i_s+i]));
+    } else {
+      for (i=0;i<n;i++) PetscCall(BVNormColumnBegin(d->auxBV,i,NORM_2,&d->nX[i_s+i]));
+      for (i=0;i<n;i++) PetscCall(BVNormColumnEnd(d->auxBV,i,NORM_2,&d->nX[i_s+i]));
+    }
 #if !defined(PETSC_USE_COMPLEX)
     for (i=0;i<n;i++) {
       if (d->eigi[i_s+i] != 0.0) {
@@ -1009,6 +1016,35 @@ PetscErrorCode dvd_improvex_compute_X(dvdDashboard *d,PetscInt i_s,PetscInt i_e,
   } else {
     for (i=0;i<n;i++) d->nX[i_s+i] = 1.0;
   }
-  if (d->correctXnorm && !u_) PetscCall(SlepcVecPoolRestoreVecs(d->auxV,i_e-i_s,&u));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Y(:,0:n-1) <- beta*Y(:,0:n-1) + alpha*X*pX(:,i_s:i_e-1)*diag(s(i_s:i_e-1)), with n = i_e-i_s,
+   computed with a single block product instead of one BVMultVec per column. As in
+   BVMultVec, the first row of pX multiplies the first non-leading active column of X.
+   The scaling s is optional.
+*/
+PetscErrorCode dvd_mult_pX(BV Y,PetscScalar alpha,PetscScalar beta,BV X,PetscScalar *pX,PetscInt ld,PetscInt i_s,PetscInt i_e,PetscScalar *s)
+{
+  PetscInt       n = i_e - i_s,i,j,l,k,ly,ky;
+  Mat            M;
+  PetscScalar    *pM;
+
+  PetscFunctionBegin;
+  if (n <= 0) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(BVGetActiveColumns(X,&l,&k));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k,n,NULL,&M));
+  PetscCall(MatDenseGetArrayWrite(M,&pM));
+  for (i=0;i<n;i++) {
+    if (s) for (j=0;j<k-l;j++) pM[k*i+l+j] = s[i_s+i]*pX[ld*(i_s+i)+j];
+    else PetscCall(PetscArraycpy(pM+k*i+l,pX+ld*(i_s+i),k-l));
+  }
+  PetscCall(MatDenseRestoreArrayWrite(M,&pM));
+  PetscCall(BVGetActiveColumns(Y,&ly,&ky));
+  PetscCall(BVSetActiveColumns(Y,0,n));
+  PetscCall(BVMult(Y,alpha,beta,X,M));
+  PetscCall(BVSetActiveColumns(Y,ly,ky));
+  PetscCall(MatDestroy(&M));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
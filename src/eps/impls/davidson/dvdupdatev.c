@@ -225,7 +225,7 @@ static PetscErrorCode dvd_updateV_restart_gen(dvdDashboard *d)
 
 static PetscErrorCode dvd_updateV_testConv(dvdDashboard *d,PetscInt s,PetscInt pre,PetscInt e,PetscInt *nConv)
 {
-  PetscInt        i,j,b;
+  PetscInt        i,j,b,r=0;
   PetscReal       norm;
   PetscBool       conv, c;
   dvdManagV_basic *data = (dvdManagV_basic*)d->updateV_data;
@@ -238,7 +238,17 @@ static PetscErrorCode dvd_updateV_testConv(dvdDashboard *d,PetscInt s,PetscInt p
 #else
     b = 1;
 #endif
-    if (i+b-1 >= pre) PetscCall(d->calcpairs_residual(d,i,i+b));
+    if (i+b-1 >= PetscMax(pre,r)) {
+      /* Compute the residuals of the next block of (up to bs) pairs at once */
+      for (r=i;r<e && (data->allResiduals || r<i+d->bs);) {
+#if !defined(PETSC_USE_COMPLEX)
+        r += d->eigi[r]!=0.0?2:1;
+#else
+        r++;
+#endif
+      }
+      PetscCall(d->calcpairs_residual(d,i,r));
+    }
     /* Test the Schur vector */
     for (j=0,c=PETSC_TRUE;j<b && c;j++) {
       norm = d->nR[i+j]/d->nX[i+j];
@@ -247,7 +257,9 @@ static PetscErrorCode dvd_updateV_testConv(dvdDashboard *d,PetscInt s,PetscInt p
     if (conv && c) { if (nConv) *nConv = i+b; }
     else conv = PETSC_FALSE;
   }
-  pre = PetscMax(pre,i);
+  /* Keep the residuals that were already computed ahead of the first unconverged pair */
+  for (j=i;j<r;j++) (void)d->testConv(d,d->eigr[j],d->eigi[j],d->nR[j]/d->nX[j],&d->errest[j]);
+  pre = PetscMax(pre,PetscMax(i,r));
 
 #if !defined(PETSC_USE_COMPLEX)
   /* Enforce converged conjugate complex eigenpairs */
@@ -154,6 +154,119 @@ PetscErrorCode EPSDelayedArnoldi1(EPS eps,PetscScalar *H,PetscInt ldh,PetscInt k
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSBatchedLanczos - Computes an m-step Lanczos factorization with local
+   orthogonalization, i.e., each new vector is orthogonalized only against
+   the two previous ones, computing both inner products and the norm in a
+   single reduction. The loss of orthogonality with respect to the rest of
+   the basis is estimated with Simon's omega recurrence, where the first k
+   (locked and kept) columns are represented by a single bound. When the
+   estimate exceeds sqrt(eps), or after s steps without it, the last two
+   Lanczos vectors are reorthogonalized against the whole basis at once,
+   with one merged reduction followed by the corresponding updates.
+*/
+PetscErrorCode EPSBatchedLanczos(EPS eps,PetscReal *alpha,PetscReal *beta,PetscInt k,PetscInt *M,PetscInt s,PetscBool *breakdown)
+{
+  PetscInt       i,j,m=*M,nsteps=0;
+  Vec            vj,vj1;
+  PetscScalar    *c0,*c1,h[2];
+  PetscReal      *om,*omold,*omnew,*swp,oo,ooold,oonew=0.0,norm,nrm0,nrm1,t,anorm=0.0,omax;
+  PetscReal      eps1=PETSC_MACHINE_EPSILON,thres=PETSC_SQRT_MACHINE_EPSILON;
+  PetscBool      lindep=PETSC_FALSE,reset;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc5(m+1,&c0,m+1,&c1,m+1,&om,m+1,&omold,m+1,&omnew));
+  for (i=0;i<=m;i++) om[i] = omold[i] = eps1;
+  oo = ooold = eps1;
+  for (i=0;i<k;i++) anorm = PetscMax(anorm,PetscAbsReal(alpha[i]));
+  *breakdown = PETSC_FALSE;
+
+  PetscCall(BVSetActiveColumns(eps->V,0,m));
+  for (j=k;j<m;j++) {
+    PetscCall(BVGetColumn(eps->V,j,&vj));
+    PetscCall(BVGetColumn(eps->V,j+1,&vj1));
+    PetscCall(STApply(eps->st,vj,vj1));
+    PetscCall(BVRestoreColumn(eps->V,j,&vj));
+    PetscCall(BVRestoreColumn(eps->V,j+1,&vj1));
+    reset = PETSC_FALSE;
+    if (j>k) {
+      /* local orthogonalization against v_{j-1} and v_j, norm in the same reduction */
+      PetscCall(BVSetActiveColumns(eps->V,j-1,m));
+      PetscCall(BVDotColumnBegin(eps->V,j+1,h));
+      PetscCall(BVNormColumnBegin(eps->V,j+1,NORM_2,&norm));
+      PetscCall(BVDotColumnEnd(eps->V,j+1,h));
+      PetscCall(BVNormColumnEnd(eps->V,j+1,NORM_2,&norm));
+      PetscCall(BVMultColumn(eps->V,-1.0,1.0,j+1,h));
+      PetscCall(BVSetActiveColumns(eps->V,0,m));
+      alpha[j] = PetscRealPart(h[1]);
+      t = norm*norm-PetscRealPart(h[0]*PetscConj(h[0])+h[1]*PetscConj(h[1]));
+      if (t>0.5*norm*norm) norm = PetscSqrtReal(t);
+      else {  /* severe cancellation, orthogonalize against the whole basis */
+        PetscCall(BVOrthogonalizeColumn(eps->V,j+1,c1,&norm,&lindep));
+        alpha[j] += PetscRealPart(c1[j]);
+        reset = PETSC_TRUE;
+      }
+    } else {  /* j==k, the first vector is coupled with all kept columns */
+      PetscCall(BVOrthogonalizeColumn(eps->V,j+1,c1,&norm,&lindep));
+      alpha[j] = PetscRealPart(c1[j]);
+      reset = PETSC_TRUE;
+    }
+    beta[j] = norm;
+    if (PetscUnlikely(lindep || norm==0.0)) {
+      *breakdown = PETSC_TRUE;
+      *M = j+1;
+      break;
+    }
+    PetscCall(BVScaleColumn(eps->V,j+1,1.0/norm));
+    anorm = PetscMax(anorm,PetscAbsReal(alpha[j])+norm+((j>k)?beta[j-1]:0.0));
+
+    /* omega recurrence, omnew[i] estimates v_{j+1}'*v_i */
+    omax = 0.0;
+    if (reset) {
+      for (i=0;i<=j;i++) omnew[i] = eps1;
+      oonew = eps1;
+    } else {
+      for (i=k;i<j;i++) {
+        t = beta[i]*((i+1<j)?om[i+1]:1.0)+(alpha[i]-alpha[j])*om[i]-beta[j-1]*((i+1<j)?omold[i]:1.0);
+        t += (i>k)? beta[i-1]*om[i-1]: (k? anorm*oo: 0.0);
+        t += ((t>=0.0)?2.0:-2.0)*eps1*anorm;
+        omnew[i] = t/norm;
+        omax = PetscMax(omax,PetscAbsReal(omnew[i]));
+      }
+      omnew[j] = eps1;
+      if (k) {
+        oonew = (2.0*anorm*oo+beta[j-1]*ooold+2.0*eps1*anorm)/norm;
+        omax = PetscMax(omax,oonew);
+      }
+    }
+
+    /* batched reorthogonalization of v_j and v_{j+1} against the whole basis */
+    nsteps++;
+    if (!reset && (omax>thres || (s && nsteps>=s))) {
+      PetscCall(PetscInfo(eps,"Reorthogonalizing Lanczos vectors %" PetscInt_FMT " and %" PetscInt_FMT " (omega=%g)\n",j,j+1,(double)omax));
+      PetscCall(BVDotColumnBegin(eps->V,j,c0));
+      PetscCall(BVDotColumnBegin(eps->V,j+1,c1));
+      PetscCall(BVDotColumnEnd(eps->V,j,c0));
+      PetscCall(BVDotColumnEnd(eps->V,j+1,c1));
+      PetscCall(BVMultColumn(eps->V,-1.0,1.0,j,c0));
+      PetscCall(BVMultColumn(eps->V,-1.0,1.0,j+1,c1));
+      nrm0 = nrm1 = 1.0;
+      for (i=0;i<j;i++) nrm0 -= PetscRealPart(c0[i]*PetscConj(c0[i]));
+      for (i=0;i<=j;i++) nrm1 -= PetscRealPart(c1[i]*PetscConj(c1[i]));
+      PetscCall(BVScaleColumn(eps->V,j,1.0/PetscSqrtReal(nrm0)));
+      PetscCall(BVScaleColumn(eps->V,j+1,1.0/PetscSqrtReal(nrm1)));
+      for (i=0;i<=j;i++) om[i] = omnew[i] = eps1;
+      oo = oonew = eps1;
+      nsteps = 0;
+    }
+    swp = omold; omold = om; om = omnew; omnew = swp;
+    ooold = oo; oo = oonew;
+  }
+  if (*breakdown) PetscCall(PetscInfo(eps,"Lanczos finished early at m=%" PetscInt_FMT "\n",*M));
+  PetscCall(PetscFree5(c0,c1,om,omold,omnew));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSKrylovConvergence_Filter - Specialized version for STFILTER.
 */
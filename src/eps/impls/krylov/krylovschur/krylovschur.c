@@ -118,6 +118,7 @@ static PetscErrorCode EPSSetUp_KrylovSchur(EPS eps)
   EPSCheckDefiniteCondition(eps,eps->arbitrary," with arbitrary selection of eigenpairs");
 
   PetscCheck(eps->extraction==EPS_RITZ || eps->extraction==EPS_HARMONIC,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Unsupported extraction type");
+  PetscCheck(!ctx->batchreorth || !eps->nds,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Batched reorthogonalization is not available with a deflation space");
 
   if (!ctx->keep) ctx->keep = 0.5;
 
@@ -227,10 +228,10 @@ static PetscErrorCode EPSSetUpSort_KrylovSchur(EPS eps)
 PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
-  PetscInt        i,j,*pj,k,l,nv,ld,nconv;
+  PetscInt        i,j,*pj,k,l,nv,ld,nconv,nrec=0;
   Mat             U,Op,H,T;
   PetscScalar     *g;
-  PetscReal       beta,gamma=1.0;
+  PetscReal       beta,gamma=1.0,*a;
   PetscBool       breakdown,harmonic,hermitian;
 
   PetscFunctionBegin;
@@ -241,8 +242,10 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
   if (eps->arbitrary) pj = &j;
   else pj = NULL;
 
-  /* Get the starting Arnoldi vector */
-  PetscCall(EPSGetStartVector(eps,0,NULL));
+  /* Get the starting Arnoldi vector, possibly after recycling the subspace of a previous solve */
+  if (eps->nrec && !eps->nini && !harmonic && !eps->arbitrary) PetscCall(EPSGetRecycledSubspace(eps));
+  else PetscCall(EPSGetStartVector(eps,0,NULL));
+  eps->nrec = 0;
   l = 0;
 
   /* Restart loop */
@@ -253,7 +256,12 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     nv = PetscMin(eps->nconv+eps->mpd,eps->ncv);
     PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,eps->nconv+l));
     PetscCall(STGetOperator(eps->st,&Op));
-    if (hermitian) {
+    if (hermitian && ctx->batchreorth) {
+      PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&a));
+      PetscCall(EPSBatchedLanczos(eps,a,a+ld,eps->nconv+l,&nv,ctx->batchreorth,&breakdown));
+      beta = a[ld+nv-1];
+      PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&a));
+    } else if (hermitian) {
       PetscCall(DSGetMat(eps->ds,DS_MAT_T,&T));
       PetscCall(BVMatLanczos(eps->V,Op,T,eps->nconv+l,&nv,&beta,&breakdown));
       PetscCall(DSRestoreMat(eps->ds,DS_MAT_T,&T));
@@ -294,6 +302,7 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     }
     if (!ctx->lock && l>0) { l += k; k = 0; } /* non-locking variant: reset no. of converged pairs */
     if (l) PetscCall(PetscInfo(eps,"Preparing to restart keeping l=%" PetscInt_FMT " vectors\n",l));
+    if (eps->reason != EPS_CONVERGED_ITERATING && eps->recycle && !harmonic) nrec = PetscMin(k+eps->nrecextra,nv);  /* vectors kept for the next solve */
 
     if (eps->reason == EPS_CONVERGED_ITERATING) {
       if (PetscUnlikely(breakdown || k==nv)) {
@@ -324,7 +333,7 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     }
     /* Update the corresponding vectors V(:,idx) = V*Q(:,idx) */
     PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&U));
-    PetscCall(BVMultInPlace(eps->V,U,eps->nconv,k+l));
+    PetscCall(BVMultInPlace(eps->V,U,eps->nconv,PetscMax(k+l,nrec)));
     PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&U));
 
     if (eps->reason == EPS_CONVERGED_ITERATING && !breakdown) {
@@ -339,11 +348,13 @@ PetscErrorCode EPSSolve_KrylovSchur_Default(EPS eps)
     }
 
     eps->nconv = k;
+    if (eps->ckptviewer && eps->reason == EPS_CONVERGED_ITERATING && !breakdown && !harmonic && !(eps->its%eps->ckptevery)) PetscCall(EPSCheckpointWrite(eps,k+l));
     PetscCall(EPSMonitor(eps,eps->its,nconv,eps->eigr,eps->eigi,eps->errest,nv));
   }
 
   if (harmonic) PetscCall(PetscFree(g));
   PetscCall(DSTruncate(eps->ds,eps->nconv,PETSC_TRUE));
+  eps->nrec = nrec;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -499,6 +510,96 @@ PetscErrorCode EPSKrylovSchurGetLocking(EPS eps,PetscBool *lock)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSKrylovSchurSetBatchReorthog_KrylovSchur(EPS eps,PetscInt s)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  if (s == PETSC_DEFAULT || s == PETSC_DECIDE) ctx->batchreorth = 0;
+  else {
+    PetscCheck(s>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The batch size must be non-negative");
+    ctx->batchreorth = s;
+  }
+  eps->state = EPS_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurSetBatchReorthog - Activates the Lanczos variant with local
+   orthogonalization and delayed, batched reorthogonalization, used in
+   Hermitian problems.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  s   - maximum number of Lanczos steps between two reorthogonalizations
+
+   Options Database Key:
+.  -eps_krylovschur_batch_reorthog <s> - Sets the maximum number of steps between reorthogonalizations
+
+   Notes:
+   By default (s=0), the Lanczos recurrence of Krylov-Schur for Hermitian
+   problems orthogonalizes every new vector against the whole basis, which
+   requires at least one global reduction per vector in the basis at each step.
+   With s>0, each new vector is orthogonalized only against the two previous
+   ones, computing the two inner products and the norm in a single reduction.
+   The loss of orthogonality is monitored with the omega recurrence, and the
+   last two Lanczos vectors are reorthogonalized against the whole basis (locked
+   and kept vectors included) when the estimate exceeds the square root of the
+   machine precision, or after s steps otherwise. This may pay off when the
+   basis is large and reductions are expensive, e.g., in runs with many processes.
+
+   This option is ignored in non-Hermitian problems, with harmonic extraction,
+   and in spectrum slicing. It cannot be combined with a deflation space.
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurGetBatchReorthog()
+@*/
+PetscErrorCode EPSKrylovSchurSetBatchReorthog(EPS eps,PetscInt s)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,s,2);
+  PetscTryMethod(eps,"EPSKrylovSchurSetBatchReorthog_C",(EPS,PetscInt),(eps,s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSKrylovSchurGetBatchReorthog_KrylovSchur(EPS eps,PetscInt *s)
+{
+  EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
+
+  PetscFunctionBegin;
+  *s = ctx->batchreorth;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSKrylovSchurGetBatchReorthog - Gets the maximum number of Lanczos steps
+   between batched reorthogonalizations.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  s - the number of steps (zero if full reorthogonalization is used)
+
+   Level: advanced
+
+.seealso: EPSKrylovSchurSetBatchReorthog()
+@*/
+PetscErrorCode EPSKrylovSchurGetBatchReorthog(EPS eps,PetscInt *s)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(s,2);
+  PetscUseMethod(eps,"EPSKrylovSchurGetBatchReorthog_C",(EPS,PetscInt*),(eps,s));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSKrylovSchurSetPartitions_KrylovSchur(EPS eps,PetscInt npart)
 {
   EPS_KRYLOVSCHUR *ctx = (EPS_KRYLOVSCHUR*)eps->data;
@@ -1463,6 +1564,10 @@ static PetscErrorCode EPSSetFromOptions_KrylovSchur(EPS eps,PetscOptionItems *Pe
     PetscCall(PetscOptionsBool("-eps_krylovschur_locking","Choose between locking and non-locking variants","EPSKrylovSchurSetLocking",PETSC_TRUE,&lock,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetLocking(eps,lock));
 
+    i = ctx->batchreorth;
+    PetscCall(PetscOptionsInt("-eps_krylovschur_batch_reorthog","Maximum number of Lanczos steps between batched reorthogonalizations","EPSKrylovSchurSetBatchReorthog",ctx->batchreorth,&i,&flg));
+    if (flg) PetscCall(EPSKrylovSchurSetBatchReorthog(eps,i));
+
     i = ctx->npart;
     PetscCall(PetscOptionsInt("-eps_krylovschur_partitions","Number of partitions of the communicator for spectrum slicing","EPSKrylovSchurSetPartitions",ctx->npart,&i,&flg));
     if (flg) PetscCall(EPSKrylovSchurSetPartitions(eps,i));
@@ -1509,6 +1614,7 @@ static PetscErrorCode EPSView_KrylovSchur(EPS eps,PetscViewer viewer)
   if (isascii) {
     PetscCall(PetscViewerASCIIPrintf(viewer,"  %d%% of basis vectors kept after restart\n",(int)(100*ctx->keep)));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  using the %slocking variant\n",ctx->lock?"":"non-"));
+    if (ctx->batchreorth && eps->ishermitian) PetscCall(PetscViewerASCIIPrintf(viewer,"  local orthogonalization, batched reorthogonalization every %" PetscInt_FMT " steps at most\n",ctx->batchreorth));
     if (eps->problem_type==EPS_BSE) PetscCall(PetscViewerASCIIPrintf(viewer,"  BSE method: %s\n",EPSKrylovSchurBSETypes[ctx->bse]));
     if (eps->which==EPS_ALL) {
       PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
@@ -1549,6 +1655,8 @@ static PetscErrorCode EPSDestroy_KrylovSchur(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBatchReorthog_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBatchReorthog_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPartitions_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDetectZeros_C",NULL));
@@ -1618,6 +1726,8 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_KrylovSchur(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetRestart_C",EPSKrylovSchurGetRestart_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetLocking_C",EPSKrylovSchurSetLocking_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetLocking_C",EPSKrylovSchurGetLocking_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetBatchReorthog_C",EPSKrylovSchurSetBatchReorthog_KrylovSchur));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetBatchReorthog_C",EPSKrylovSchurGetBatchReorthog_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetPartitions_C",EPSKrylovSchurSetPartitions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurGetPartitions_C",EPSKrylovSchurGetPartitions_KrylovSchur));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSKrylovSchurSetDetectZeros_C",EPSKrylovSchurSetDetectZeros_KrylovSchur));
@@ -18,6 +18,10 @@
        restart and deflation. Several reorthogonalization strategies can
        be selected.
 
+       A two-pass variant without restart is also available, that keeps
+       only the tridiagonal matrix and three vectors during the iteration,
+       and regenerates the basis to compute the Ritz vectors.
+
    References:
 
        [1] "Lanczos Methods in SLEPc", SLEPc Technical Report STR-5,
@@ -31,8 +35,18 @@ typedef struct {
   EPSLanczosReorthogType reorthog;      /* user-provided reorthogonalization parameter */
   PetscInt               allocsize;     /* number of columns of work BV's allocated at setup */
   BV                     AV;            /* work BV used in selective reorthogonalization */
+  PetscBool              twopass;       /* two-pass variant, the basis is not stored */
+  BV                     W;             /* vectors of the three-term recurrence in the two-pass variant */
+  PetscInt               m;             /* number of Lanczos steps in the two-pass variant */
+  PetscReal              *alpha,*beta;  /* tridiagonal matrix of the two-pass variant */
+  PetscScalar            *gamma;        /* coefficients against v_{j-1} in the local reorthogonalization */
+  PetscScalar            *S;            /* coefficients of the Ritz vectors in the two-pass variant */
 } EPS_LANCZOS;
 
+static PetscErrorCode EPSSolve_Lanczos(EPS);
+static PetscErrorCode EPSSolve_Lanczos_TwoPass(EPS);
+static PetscErrorCode EPSComputeVectors_Lanczos_TwoPass(EPS);
+
 static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
 {
   EPS_LANCZOS        *lanczos = (EPS_LANCZOS*)eps->data;
@@ -43,9 +57,19 @@ static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
   PetscFunctionBegin;
   EPSCheckHermitianDefinite(eps);
   EPSCheckNotStructured(eps);
-  PetscCall(EPSSetDimensions_Default(eps,&eps->nev,&eps->ncv,&eps->mpd));
-  PetscCheck(eps->ncv<=eps->nev+eps->mpd,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The value of ncv must not be larger than nev+mpd");
-  if (eps->max_it==PETSC_DETERMINE) eps->max_it = PetscMax(100,2*eps->n/eps->ncv);
+  if (lanczos->twopass) {
+    /* ncv is the number of stored eigenvectors, mpd the number of steps between convergence checks */
+    if (eps->nev==0) eps->nev = 1;
+    if (eps->ncv!=PETSC_DETERMINE) {
+      PetscCheck(eps->ncv>=eps->nev,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The value of ncv must be at least nev");
+    } else eps->ncv = eps->nev;
+    if (eps->mpd==PETSC_DETERMINE) eps->mpd = PetscMin(eps->n,PetscMax(2*eps->nev,eps->nev+15));
+    if (eps->max_it==PETSC_DETERMINE) eps->max_it = PetscMax(100,2*eps->n/eps->mpd);
+  } else {
+    PetscCall(EPSSetDimensions_Default(eps,&eps->nev,&eps->ncv,&eps->mpd));
+    PetscCheck(eps->ncv<=eps->nev+eps->mpd,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The value of ncv must not be larger than nev+mpd");
+    if (eps->max_it==PETSC_DETERMINE) eps->max_it = PetscMax(100,2*eps->n/eps->ncv);
+  }
   if (!eps->which) PetscCall(EPSSetWhichEigenpairs_Default(eps));
   PetscCheck(eps->which!=EPS_ALL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver does not support computing all eigenvalues");
   EPSCheckUnsupported(eps,EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION | EPS_FEATURE_EXTRACTION | EPS_FEATURE_THRESHOLD);
@@ -53,7 +77,9 @@ static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
 
   PetscCheck(lanczos->reorthog!=(EPSLanczosReorthogType)-1,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"You should explicitly provide the reorthogonalization type, e.g., -eps_lanczos_reorthog local. Note that the EPSLANCZOS solver is *NOT RECOMMENDED* for general use, because it uses explicit restart which typically has slow convergence. The recommended solver is EPSKRYLOVSCHUR (the default), which implements Lanczos with thick restart in the case of symmetric/Hermitian problems");
 
-  PetscCall(EPSAllocateSolution(eps,1));
+  PetscCheck(!lanczos->twopass || lanczos->reorthog==EPS_LANCZOS_REORTHOG_LOCAL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The two-pass variant is only available with local reorthogonalization");
+
+  PetscCall(EPSAllocateSolution(eps,lanczos->twopass?0:1));
   PetscCall(EPS_SetInnerProduct(eps));
   if (lanczos->reorthog != EPS_LANCZOS_REORTHOG_FULL) {
     PetscCall(BVGetOrthogonalization(eps->V,NULL,&refine,&eta,&btype));
@@ -74,6 +100,15 @@ static PetscErrorCode EPSSetUp_Lanczos(EPS eps)
   PetscCall(DSSetCompact(eps->ds,PETSC_TRUE));
   PetscCall(DSAllocate(eps->ds,eps->ncv+1));
   if (lanczos->reorthog == EPS_LANCZOS_REORTHOG_LOCAL) PetscCall(EPSSetWorkVecs(eps,1));
+  if (lanczos->twopass) {
+    PetscCall(BVDestroy(&lanczos->W));
+    PetscCall(BVDuplicateResize(eps->V,3,&lanczos->W));
+    eps->ops->solve          = EPSSolve_Lanczos_TwoPass;
+    eps->ops->computevectors = EPSComputeVectors_Lanczos_TwoPass;
+  } else {
+    eps->ops->solve          = EPSSolve_Lanczos;
+    eps->ops->computevectors = EPSComputeVectors_Hermitian;
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -177,6 +212,36 @@ static PetscErrorCode DenseTridiagonal(PetscInt n_,PetscReal *D,PetscReal *E,Pet
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   TridiagonalEigenvector - Computes the eigenvector of a real tridiagonal Hermitian
+   matrix associated with its i-th smallest eigenvalue (counting from zero).
+
+   Notes:
+   Only one eigenvector is computed, with LAPACK routine xSTEVR, so the cost is
+   linear in n. The arrays D and E are overwritten.
+*/
+static PetscErrorCode TridiagonalEigenvector(PetscInt n_,PetscReal *D,PetscReal *E,PetscInt i,PetscScalar *y)
+{
+  PetscInt       j;
+  PetscReal      abstol = 0.0,vl,vu,*w,*yy,*work;
+  PetscBLASInt   il,iu,m,isuppz[2],n,lwork,*iwork,liwork,info;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(n_,&n));
+  PetscCall(PetscBLASIntCast(i+1,&il));
+  iu = il;
+  PetscCall(PetscBLASIntCast(20*n_,&lwork));
+  PetscCall(PetscBLASIntCast(10*n_,&liwork));
+  PetscCall(PetscMalloc4(n,&w,n,&yy,lwork,&work,liwork,&iwork));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKstevr",LAPACKstevr_("V","I",&n,D,E,&vl,&vu,&il,&iu,&abstol,&m,w,yy,&n,isuppz,work,&lwork,iwork,&liwork,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("stevr",info);
+  for (j=0;j<n_;j++) y[j] = yy[j];
+  PetscCall(PetscFree4(w,yy,work,iwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    EPSSelectiveLanczos - Selective reorthogonalization.
 */
@@ -696,10 +761,223 @@ static PetscErrorCode EPSSolve_Lanczos(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSTwoPassLanczosStep - One step of the three-term recurrence of the two-pass
+   variant. The BV W holds v_{j-1} and v_j in its first two columns, and on exit
+   they are shifted so that W holds v_j and v_{j+1}.
+
+   If compute is true then the new vector is orthogonalized against v_{j-1} and v_j
+   with BVOrthogonalizeColumn(), that is, with local reorthogonalization as in
+   EPSLocalLanczos(), and alpha_j, beta_j and the coefficient gamma_j against v_{j-1}
+   are stored. Otherwise the stored values are used, so that the same basis is
+   regenerated without global reductions.
+*/
+static PetscErrorCode EPSTwoPassLanczosStep(BV W,Mat Op,PetscInt j,PetscReal *alpha,PetscReal *beta,PetscScalar *gamma,PetscBool compute)
+{
+  PetscScalar h[3];
+
+  PetscFunctionBegin;
+  PetscCall(BVSetActiveColumns(W,0,3));
+  PetscCall(BVMatMultColumn(W,Op,1));
+  if (compute) {
+    PetscCall(BVOrthogonalizeColumn(W,2,h,beta+j,NULL));
+    gamma[j] = h[0];
+    alpha[j] = PetscRealPart(h[1]);
+  } else {
+    h[0] = gamma[j];
+    h[1] = alpha[j];
+    PetscCall(BVMultColumn(W,-1.0,1.0,2,h));
+  }
+  if (beta[j]>0.0) PetscCall(BVScaleColumn(W,2,1.0/beta[j]));
+  PetscCall(BVCopyColumn(W,1,0));
+  PetscCall(BVCopyColumn(W,2,1));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSTwoPassLanczosStart - Places the initial vector (stored in the first work
+   vector) at the start of the recurrence.
+*/
+static PetscErrorCode EPSTwoPassLanczosStart(EPS eps)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+  Vec         v;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetColumn(lanczos->W,0,&v));
+  PetscCall(VecSet(v,0.0));
+  PetscCall(BVRestoreColumn(lanczos->W,0,&v));
+  PetscCall(BVInsertVec(lanczos->W,1,eps->work[0]));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSSolve_Lanczos_TwoPass - First pass of the two-pass variant.
+
+   The Lanczos recurrence is run without restart, keeping only the entries of
+   the tridiagonal matrix T and the vectors of the three-term recurrence. Every
+   mpd steps the eigenvalues of T are computed, and copies of already converged
+   Ritz values that appear due to the loss of orthogonality are discarded. Only
+   the eigenvectors of T for the wanted Ritz values are computed, one at a time,
+   so the work per check is linear in the number of steps. The coefficients of
+   the converged Ritz vectors are kept for the second pass, see
+   EPSComputeVectors_Lanczos_TwoPass().
+*/
+static PetscErrorCode EPSSolve_Lanczos_TwoPass(EPS eps)
+{
+  EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
+  PetscInt       i,k,m=0,cap=0,nconv=0,nest,ncv=eps->ncv,*perm;
+  PetscReal      *alpha=NULL,*beta=NULL,*aux,*D,*E,*w,anorm,tnorm=0.0,resnorm,err;
+  PetscScalar    *gamma=NULL,*gaux,*Y,*y,*ritz,*ritzi;
+  PetscBool      breakdown=PETSC_FALSE,isconv;
+  Mat            Op;
+  SlepcSC        sc;
+
+  PetscFunctionBegin;
+  PetscCall(PetscFree3(lanczos->alpha,lanczos->beta,lanczos->gamma));
+  PetscCall(PetscFree(lanczos->S));
+  lanczos->m = 0;
+  PetscCall(DSGetSlepcSC(eps->ds,&sc));
+
+  /* The first Lanczos vector is the normalized initial vector, saved for the second pass */
+  PetscCall(EPSGetStartVector(eps,0,NULL));
+  PetscCall(BVCopyVec(eps->V,0,eps->work[0]));
+  PetscCall(EPSTwoPassLanczosStart(eps));
+  PetscCall(STGetOperator(eps->st,&Op));
+
+  while (eps->reason == EPS_CONVERGED_ITERATING) {
+    eps->its++;
+
+    /* Extend the tridiagonal matrix with mpd more steps */
+    if (m+eps->mpd>cap) {
+      cap = m+eps->mpd;
+      PetscCall(PetscMalloc1(2*cap,&aux));
+      PetscCall(PetscArraycpy(aux,alpha,m));
+      PetscCall(PetscArraycpy(aux+cap,beta,m));
+      PetscCall(PetscFree(alpha));
+      alpha = aux;
+      beta  = aux+cap;
+      PetscCall(PetscMalloc1(cap,&gaux));
+      PetscCall(PetscArraycpy(gaux,gamma,m));
+      PetscCall(PetscFree(gamma));
+      gamma = gaux;
+    }
+    for (k=0;k<eps->mpd && !breakdown;k++,m++) {
+      PetscCall(EPSTwoPassLanczosStep(lanczos->W,Op,m,alpha,beta,gamma,PETSC_TRUE));
+      tnorm = PetscMax(tnorm,PetscAbsReal(alpha[m])+beta[m]+(m?beta[m-1]:0.0));
+      breakdown = (beta[m]<=PETSC_MACHINE_EPSILON*tnorm)? PETSC_TRUE: PETSC_FALSE;
+    }
+
+    /* Ritz values of T, without eigenvectors */
+    PetscCall(PetscMalloc4(m,&D,m,&E,m,&w,m*(ncv+1),&Y));
+    PetscCall(PetscMalloc3(m,&ritz,m,&ritzi,m,&perm));
+    PetscCall(PetscArraycpy(D,alpha,m));
+    PetscCall(PetscArraycpy(E,beta,m));
+    PetscCall(DenseTridiagonal(m,D,E,w,NULL));
+    anorm = 0.0;
+    for (i=0;i<m;i++) {
+      ritz[i]  = w[i];
+      ritzi[i] = 0.0;
+      anorm    = PetscMax(anorm,PetscAbsReal(w[i]));
+    }
+    PetscCall(SlepcSortEigenvalues(sc,m,ritz,ritzi,perm));
+
+    /* Leading converged Ritz values in the sorting order, discarding copies; the
+       eigenvector of T is computed only for the Ritz values that are examined and
+       kept in the first ncv columns of Y, the last column is workspace */
+    nconv  = 0;
+    nest   = 0;
+    isconv = PETSC_TRUE;
+    y      = Y+ncv*m;
+    for (k=0;k<m && nest<ncv;k++) {
+      i = perm[k];
+      PetscCall(PetscArraycpy(D,alpha,m));
+      PetscCall(PetscArraycpy(E,beta,m));
+      PetscCall(TridiagonalEigenvector(m,D,E,i,y));
+      resnorm = beta[m-1]*PetscAbsScalar(y[m-1]) + PETSC_MACHINE_EPSILON*anorm;
+      PetscCall((*eps->converged)(eps,w[i],0.0,resnorm,&err,eps->convergedctx));
+      if (err<eps->tol && nest && eps->errest[nest-1]<eps->tol && PetscAbsReal((w[i]-PetscRealPart(eps->eigr[nest-1]))/w[i])<eps->tol) continue;
+      if (isconv && err<eps->tol) nconv++;
+      else isconv = PETSC_FALSE;
+      eps->eigr[nest]   = w[i];
+      eps->errest[nest] = err;
+      PetscCall(PetscArraycpy(Y+nest*m,y,m));
+      nest++;
+    }
+    PetscCall(EPSMonitor(eps,eps->its,nconv,eps->eigr,eps->eigi,eps->errest,nest));
+    PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,nconv,eps->nev,&eps->reason,eps->stoppingctx));
+    if (breakdown && eps->reason == EPS_CONVERGED_ITERATING) {
+      /* the Krylov subspace is invariant, the two-pass variant cannot restart */
+      PetscCall(PetscInfo(eps,"Breakdown in two-pass Lanczos method (it=%" PetscInt_FMT " norm=%g)\n",eps->its,(double)beta[m-1]));
+      eps->reason = EPS_DIVERGED_BREAKDOWN;
+    }
+    if (eps->reason != EPS_CONVERGED_ITERATING) {
+      /* keep the coefficients of the Ritz vectors for the second pass */
+      PetscCall(PetscMalloc1(m*nconv,&lanczos->S));
+      PetscCall(PetscArraycpy(lanczos->S,Y,m*nconv));
+    }
+    PetscCall(PetscFree4(D,E,w,Y));
+    PetscCall(PetscFree3(ritz,ritzi,perm));
+  }
+  PetscCall(STRestoreOperator(eps->st,&Op));
+  eps->nconv = nconv;
+
+  /* keep the tridiagonal matrix for the second pass */
+  PetscCall(PetscMalloc3(m,&lanczos->alpha,m,&lanczos->beta,m,&lanczos->gamma));
+  PetscCall(PetscArraycpy(lanczos->alpha,alpha,m));
+  PetscCall(PetscArraycpy(lanczos->beta,beta,m));
+  PetscCall(PetscArraycpy(lanczos->gamma,gamma,m));
+  lanczos->m = m;
+  PetscCall(PetscFree(alpha));
+  PetscCall(PetscFree(gamma));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSComputeVectors_Lanczos_TwoPass - Second pass of the two-pass variant.
+
+   The Lanczos basis is regenerated from the saved initial vector with the stored
+   tridiagonal matrix, and the Ritz vectors are accumulated on the fly, one Lanczos
+   vector at a time.
+*/
+static PetscErrorCode EPSComputeVectors_Lanczos_TwoPass(EPS eps)
+{
+  EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
+  PetscInt       i,j,m=lanczos->m,nconv=eps->nconv;
+  PetscScalar    *pQ;
+  Mat            Op,Q;
+
+  PetscFunctionBegin;
+  if (nconv) {
+    PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,2,nconv,NULL,&Q));
+    PetscCall(BVSetActiveColumns(eps->V,0,nconv));
+    PetscCall(BVScale(eps->V,0.0));
+    PetscCall(EPSTwoPassLanczosStart(eps));
+    PetscCall(STGetOperator(eps->st,&Op));
+    for (j=0;j<m;j++) {
+      /* V = V + v_j*S(j,:) */
+      PetscCall(MatDenseGetArray(Q,&pQ));
+      for (i=0;i<nconv;i++) {
+        pQ[2*i]   = 0.0;
+        pQ[1+2*i] = lanczos->S[j+i*m];
+      }
+      PetscCall(MatDenseRestoreArray(Q,&pQ));
+      PetscCall(BVSetActiveColumns(lanczos->W,1,2));
+      PetscCall(BVMult(eps->V,1.0,1.0,lanczos->W,Q));
+      if (j<m-1) PetscCall(EPSTwoPassLanczosStep(lanczos->W,Op,j,lanczos->alpha,lanczos->beta,lanczos->gamma,PETSC_FALSE));
+    }
+    PetscCall(STRestoreOperator(eps->st,&Op));
+    PetscCall(MatDestroy(&Q));
+    PetscCall(BVNormalize(eps->V,NULL));
+  }
+  PetscCall(EPSComputeVectors_Hermitian(eps));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSetFromOptions_Lanczos(EPS eps,PetscOptionItems *PetscOptionsObject)
 {
   EPS_LANCZOS            *lanczos = (EPS_LANCZOS*)eps->data;
-  PetscBool              flg;
+  PetscBool              flg,val;
   EPSLanczosReorthogType reorthog=EPS_LANCZOS_REORTHOG_LOCAL,curval;
 
   PetscFunctionBegin;
@@ -709,6 +987,9 @@ static PetscErrorCode EPSSetFromOptions_Lanczos(EPS eps,PetscOptionItems *PetscO
     PetscCall(PetscOptionsEnum("-eps_lanczos_reorthog","Lanczos reorthogonalization","EPSLanczosSetReorthog",EPSLanczosReorthogTypes,(PetscEnum)curval,(PetscEnum*)&reorthog,&flg));
     if (flg) PetscCall(EPSLanczosSetReorthog(eps,reorthog));
 
+    PetscCall(PetscOptionsBool("-eps_lanczos_twopass","Use the two-pass variant that does not store the basis","EPSLanczosSetTwoPass",lanczos->twopass,&val,&flg));
+    if (flg) PetscCall(EPSLanczosSetTwoPass(eps,val));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -797,6 +1078,96 @@ PetscErrorCode EPSLanczosGetReorthog(EPS eps,EPSLanczosReorthogType *reorthog)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSLanczosSetTwoPass_Lanczos(EPS eps,PetscBool twopass)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  if (lanczos->twopass != twopass) {
+    lanczos->twopass = twopass;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosSetTwoPass - Activates the two-pass variant of the Lanczos method,
+   that does not store the Lanczos basis.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigenproblem solver context
+-  twopass - whether the two-pass variant is used
+
+   Options Database Key:
+.  -eps_lanczos_twopass - Activates the two-pass variant
+
+   Notes:
+   In the two-pass variant, the Lanczos recurrence is run without restart and
+   only the tridiagonal matrix and three vectors are kept, so the memory required
+   for the basis does not depend on the number of Lanczos steps. The convergence
+   of the Ritz values is checked every mpd steps, and copies of converged Ritz
+   values that arise from the loss of orthogonality are discarded. Eigenvectors
+   are computed only when requested, with a second pass that regenerates the
+   Lanczos basis from the stored tridiagonal matrix (without global reductions)
+   and accumulates the Ritz vectors on the fly. This doubles the number of
+   applications of the operator, so it is most advantageous when only eigenvalues
+   are needed.
+
+   In this variant, ncv is the number of stored eigenvectors (nev by default),
+   and the maximum number of iterations refers to the number of convergence
+   checks. It can only be used with local reorthogonalization: each new vector
+   is orthogonalized against the two previous ones, and the coefficients are
+   stored so that the second pass regenerates the same basis.
+
+   Level: advanced
+
+.seealso: EPSLanczosGetTwoPass(), EPSLanczosSetReorthog(), EPSSetDimensions()
+@*/
+PetscErrorCode EPSLanczosSetTwoPass(EPS eps,PetscBool twopass)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,twopass,2);
+  PetscTryMethod(eps,"EPSLanczosSetTwoPass_C",(EPS,PetscBool),(eps,twopass));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSLanczosGetTwoPass_Lanczos(EPS eps,PetscBool *twopass)
+{
+  EPS_LANCZOS *lanczos = (EPS_LANCZOS*)eps->data;
+
+  PetscFunctionBegin;
+  *twopass = lanczos->twopass;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLanczosGetTwoPass - Returns the flag indicating whether the two-pass
+   variant of the Lanczos method is used.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  twopass - the flag
+
+   Level: advanced
+
+.seealso: EPSLanczosSetTwoPass()
+@*/
+PetscErrorCode EPSLanczosGetTwoPass(EPS eps,PetscBool *twopass)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(twopass,2);
+  PetscUseMethod(eps,"EPSLanczosGetTwoPass_C",(EPS,PetscBool*),(eps,twopass));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSReset_Lanczos(EPS eps)
 {
   EPS_LANCZOS    *lanczos = (EPS_LANCZOS*)eps->data;
@@ -804,6 +1175,10 @@ static PetscErrorCode EPSReset_Lanczos(EPS eps)
   PetscFunctionBegin;
   PetscCall(BVDestroy(&lanczos->AV));
   lanczos->allocsize = 0;
+  PetscCall(BVDestroy(&lanczos->W));
+  PetscCall(PetscFree3(lanczos->alpha,lanczos->beta,lanczos->gamma));
+  PetscCall(PetscFree(lanczos->S));
+  lanczos->m = 0;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -813,6 +1188,8 @@ static PetscErrorCode EPSDestroy_Lanczos(EPS eps)
   PetscCall(PetscFree(eps->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetReorthog_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetReorthog_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetTwoPass_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetTwoPass_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -825,6 +1202,7 @@ static PetscErrorCode EPSView_Lanczos(EPS eps,PetscViewer viewer)
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
     if (lanczos->reorthog != (EPSLanczosReorthogType)-1) PetscCall(PetscViewerASCIIPrintf(viewer,"  %s reorthogonalization\n",EPSLanczosReorthogTypes[lanczos->reorthog]));
+    if (lanczos->twopass) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the two-pass variant\n"));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -852,5 +1230,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Lanczos(EPS eps)
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetReorthog_C",EPSLanczosSetReorthog_Lanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetReorthog_C",EPSLanczosGetReorthog_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosSetTwoPass_C",EPSLanczosSetTwoPass_Lanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSLanczosGetTwoPass_C",EPSLanczosGetTwoPass_Lanczos));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -13,9 +13,15 @@
 */
 
 #include <slepc/private/epsimpl.h>
+#include <slepc/private/dsimpl.h>
+
+typedef struct {
+  PetscBool distributed;   /* reduce to tridiagonal form in parallel */
+} EPS_LAPACK;
 
 static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
 {
+  EPS_LAPACK     *ctx = (EPS_LAPACK*)eps->data;
   int            ierra,ierrb;
   PetscBool      isshift,flg,denseok=PETSC_FALSE;
   Mat            A,B,OP,shell,Ar,Br,Adense=NULL,Bdense=NULL,Ads,Bds;
@@ -23,6 +29,7 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
   PetscInt       nmat;
   KSP            ksp;
   PC             pc;
+  DSParallelType pmode;
 
   PetscFunctionBegin;
   if (eps->nev==0) eps->nev = 1;
@@ -33,10 +40,29 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
   PetscCheck(eps->which!=EPS_ALL || eps->inta==eps->intb,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"This solver does not support interval computation");
   EPSCheckUnsupported(eps,EPS_FEATURE_BALANCE | EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION);
   EPSCheckIgnored(eps,EPS_FEATURE_EXTRACTION | EPS_FEATURE_CONVERGENCE | EPS_FEATURE_STOPPING);
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+
+  /* distributed mode: the matrix is reduced to tridiagonal form in parallel in EPSSolve(),
+     and only the nev wanted eigenvectors are computed, so the DS is not used */
+  PetscCall(DSGetParallel(eps->ds,&pmode));
+  ctx->distributed = PETSC_FALSE;
+  if (pmode==DS_PARALLEL_DISTRIBUTED) {
+    if (isshift && eps->ishermitian && !eps->isgeneralized && !eps->twosided) {
+      ctx->distributed = PETSC_TRUE;
+      eps->ncv = eps->nev;
+      PetscCall(EPSAllocateSolution(eps,0));
+      PetscCall(DSSetType(eps->ds,DSHEP));
+      PetscCall(STGetKSP(eps->st,&ksp));
+      PetscCall(KSPSetType(ksp,KSPPREONLY));
+      PetscCall(KSPGetPC(ksp,&pc));
+      PetscCall(PCSetType(pc,PCNONE));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    PetscCall(PetscInfo(eps,"The distributed mode is available only for standard Hermitian problems, using the redundant mode\n"));
+  }
   PetscCall(EPSAllocateSolution(eps,0));
 
   /* attempt to get dense representations of A and B separately */
-  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
   if (isshift) {
     PetscCall(STGetNumMatrices(eps->st,&nmat));
     PetscCall(STGetMatrix(eps->st,0,&A));
@@ -113,13 +139,59 @@ static PetscErrorCode EPSSetUp_LAPACK(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Distributed mode: all processes take part in the reduction to tridiagonal form
+   of a MATMPIDENSE copy of the matrix, the wanted eigenvectors of the tridiagonal
+   matrix are computed redundantly, and then each process obtains its rows of the
+   eigenvectors by applying the Householder reflectors
+*/
+static PetscErrorCode EPSSolve_LAPACK_Distributed(EPS eps)
+{
+  PetscInt       n=eps->n,nev=eps->nev,ldv,nc,low,high;
+  Mat            A,Adist;
+  PetscScalar    shift,*tau,*pV;
+  PetscReal      *d,*e;
+  SlepcSC        sc;
+
+  PetscFunctionBegin;
+  PetscCall(STGetMatrix(eps->st,0,&A));
+  PetscCall(MatConvert(A,MATDENSE,MAT_INITIAL_MATRIX,&Adist));
+  PetscCall(STGetShift(eps->st,&shift));
+  if (shift != 0.0) PetscCall(MatShift(Adist,-shift));
+  PetscCall(PetscMalloc3(n,&d,n,&e,n,&tau));
+  PetscCall(DSReduceDistributed_HEP(Adist,d,e,tau));
+
+  /* eigenvectors, only the local rows of the wanted ones */
+  PetscCall(DSGetSlepcSC(eps->ds,&sc));
+  PetscCall(MatGetOwnershipRange(Adist,&low,&high));
+  PetscCall(BVGetNumConstraints(eps->V,&nc));
+  PetscCall(BVGetLeadingDimension(eps->V,&ldv));
+  PetscCall(BVGetArray(eps->V,&pV));
+  PetscCall(DSSolveDistributed_HEP(sc,n,d,e,nev,eps->eigr,low,high,pV+nc*ldv,ldv));
+  PetscCall(DSBackTransformDistributed_HEP(Adist,tau,nev,pV+nc*ldv,ldv));
+  PetscCall(BVRestoreArray(eps->V,&pV));
+  PetscCall(PetscArrayzero(eps->eigi,nev));
+  PetscCall(PetscFree3(d,e,tau));
+  PetscCall(MatDestroy(&Adist));
+
+  eps->nconv  = nev;
+  eps->its    = 1;
+  eps->reason = EPS_CONVERGED_TOL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSolve_LAPACK(EPS eps)
 {
+  EPS_LAPACK     *ctx = (EPS_LAPACK*)eps->data;
   PetscInt       n=eps->n,i,low,high;
   PetscScalar    *array,*pX,*pY;
   Vec            v,w;
 
   PetscFunctionBegin;
+  if (ctx->distributed) {
+    PetscCall(EPSSolve_LAPACK_Distributed(eps));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
   PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
   PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
@@ -158,9 +230,20 @@ static PetscErrorCode EPSSolve_LAPACK(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSDestroy_LAPACK(EPS eps)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscFree(eps->data));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode EPSCreate_LAPACK(EPS eps)
 {
+  EPS_LAPACK     *ctx;
+
   PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  eps->data  = (void*)ctx;
   eps->useds = PETSC_TRUE;
   eps->categ = EPS_CATEGORY_OTHER;
 
@@ -168,5 +251,6 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_LAPACK(EPS eps)
   eps->ops->setup          = EPSSetUp_LAPACK;
   eps->ops->setupsort      = EPSSetUpSort_Default;
   eps->ops->backtransform  = EPSBackTransform_Default;
+  eps->ops->destroy        = EPSDestroy_LAPACK;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -24,6 +24,9 @@
        It can also be used for nonlinear inverse iteration on the problem
        A(x)*x=lambda*B(x)*x, where A and B are not constant but depend on x.
 
+       With constant shifts, a block variant (subspace iteration) is available
+       that iterates several vectors simultaneously.
+
    References:
 
        [1] "Single Vector Iteration Methods in SLEPc", SLEPc Technical Report
@@ -38,6 +41,7 @@
 
 static PetscErrorCode EPSPowerFormFunction_Update(SNES,Vec,Vec,void*);
 static PetscErrorCode EPSSolve_Power(EPS);
+static PetscErrorCode EPSSolve_Power_Block(EPS);
 static PetscErrorCode EPSSolve_TS_Power(EPS);
 
 typedef struct {
@@ -56,6 +60,8 @@ typedef struct {
   PetscInt          idx;  /* index of the first nonzero entry in the iteration vector */
   PetscMPIInt       p;    /* process id of the owner of idx */
   PetscReal         norm0; /* norm of initial vector */
+  PetscInt          bs;    /* block size */
+  BV                Y,R;   /* work bases for the block variant */
 } EPS_POWER;
 
 static PetscErrorCode SNESMonitor_PowerUpdate(SNES snes,PetscInt its,PetscReal fnorm,void *ctx)
@@ -87,7 +93,7 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
   if (eps->nev==0) eps->nev = 1;
   if (eps->ncv!=PETSC_DETERMINE) {
     PetscCheck(eps->ncv>=eps->nev,PetscObjectComm((PetscObject)eps),PETSC_ERR_USER_INPUT,"The value of ncv must be at least nev");
-  } else eps->ncv = eps->nev;
+  } else eps->ncv = eps->nev+power->bs-1;
   if (eps->mpd!=PETSC_DETERMINE) PetscCall(PetscInfo(eps,"Warning: parameter mpd ignored\n"));
   if (eps->max_it==PETSC_DETERMINE) {
     /* SNES will directly return the solution for us, and we need to do only one iteration */
@@ -102,6 +108,11 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
     PetscCall(STGetMatMode(eps->st,&mode));
     PetscCheck(mode!=ST_MATMODE_INPLACE,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"ST matrix mode inplace does not work with variable shifts");
   }
+  if (power->bs>1) {
+    PetscCheck(!power->nonlinear,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The block variant is not available for nonlinear inverse iteration");
+    PetscCheck(power->shift_type==EPS_POWER_SHIFT_CONSTANT,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The block variant requires constant shifts");
+    PetscCheck(!eps->twosided,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"The block variant does not have a two-sided version");
+  }
   EPSCheckUnsupported(eps,EPS_FEATURE_BALANCE | EPS_FEATURE_ARBITRARY | EPS_FEATURE_REGION | EPS_FEATURE_CONVERGENCE | EPS_FEATURE_THRESHOLD);
   EPSCheckIgnored(eps,EPS_FEATURE_EXTRACTION);
   PetscCall(EPSAllocateSolution(eps,0));
@@ -176,10 +187,17 @@ static PetscErrorCode EPSSetUp_Power(EPS eps)
     if (eps->twosided) PetscCall(EPSSetWorkVecs(eps,3));
     else PetscCall(EPSSetWorkVecs(eps,2));
     PetscCall(DSSetType(eps->ds,DSNHEP));
-    PetscCall(DSAllocate(eps->ds,eps->nev));
+    if (power->bs>1) {
+      PetscCall(DSAllocate(eps->ds,eps->ncv));
+      PetscCall(BVDestroy(&power->Y));
+      PetscCall(BVDuplicate(eps->V,&power->Y));
+      PetscCall(BVDestroy(&power->R));
+      PetscCall(BVDuplicate(eps->V,&power->R));
+    } else PetscCall(DSAllocate(eps->ds,eps->nev));
   }
   /* dispatch solve method */
-  if (eps->twosided) {
+  if (power->bs>1) eps->ops->solve = EPSSolve_Power_Block;
+  else if (eps->twosided) {
     PetscCheck(!power->nonlinear,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Nonlinear inverse iteration does not have two-sided variant");
     PetscCheck(power->shift_type!=EPS_POWER_SHIFT_WILKINSON,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Two-sided variant does not support Wilkinson shifts");
     eps->ops->solve = EPSSolve_TS_Power;
@@ -575,6 +593,103 @@ static PetscErrorCode EPSSolve_Power(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Block variant: a block of bs vectors is iterated at once (subspace iteration),
+   with a Schur-Rayleigh-Ritz projection after each application of the operator.
+   Converged leading Schur vectors are locked, and the partial Schur form
+   OP*V=V*T is built in the DS as in the single-vector version.
+*/
+static PetscErrorCode EPSSolve_Power_Block(EPS eps)
+{
+  EPS_POWER      *power = (EPS_POWER*)eps->data;
+  PetscInt       i,j,k,nv,nb,ncv=eps->ncv,bs=power->bs;
+  Mat            S,H,Q;
+  BV             Y=power->Y,R=power->R;
+  PetscReal      *rnorm,nrm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc1(ncv,&rnorm));
+  PetscCall(STGetOperator(eps->st,&S));
+
+  /* Complete the initial block with random vectors and orthonormalize them */
+  for (k=eps->nini;k<PetscMin(bs,ncv);k++) {
+    PetscCall(BVSetRandomColumn(eps->V,k));
+    PetscCall(BVOrthonormalizeColumn(eps->V,k,PETSC_TRUE,NULL,NULL));
+  }
+
+  while (eps->reason == EPS_CONVERGED_ITERATING) {
+    eps->its++;
+    k  = eps->nconv;
+    nv = PetscMin(k+bs,ncv);
+    PetscCall(DSSetDimensions(eps->ds,nv,k,0));
+
+    /* Y(:,k:nv) = OP * V(:,k:nv) */
+    PetscCall(BVSetActiveColumns(eps->V,k,nv));
+    PetscCall(BVSetActiveColumns(Y,k,nv));
+    PetscCall(BVMatMult(eps->V,S,Y));
+
+    /* T(:,k:nv) = V' * Y(:,k:nv), the locked part of T is kept */
+    PetscCall(BVSetActiveColumns(eps->V,0,nv));
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(BVDot(Y,eps->V,H));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+
+    /* Schur-Rayleigh-Ritz on the active block */
+    PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
+    PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
+
+    /* V(:,k:nv) = V * Q(:,k:nv), Y(:,k:nv) = Y * Q(:,k:nv) */
+    PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
+    PetscCall(BVSetActiveColumns(eps->V,k,nv));
+    PetscCall(BVMultInPlace(eps->V,Q,k,nv));
+    PetscCall(BVMultInPlace(Y,Q,k,nv));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&Q));
+
+    /* R(:,k:nv) = Y(:,k:nv) - V * T(:,k:nv) */
+    PetscCall(BVSetActiveColumns(R,k,nv));
+    PetscCall(BVCopy(Y,R));
+    PetscCall(BVSetActiveColumns(eps->V,0,nv));
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(BVMult(R,-1.0,1.0,eps->V,H));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+    for (i=k;i<nv;i++) PetscCall(BVNormColumnBegin(R,i,NORM_2,rnorm+i));
+    for (i=k;i<nv;i++) PetscCall(BVNormColumnEnd(R,i,NORM_2,rnorm+i));
+
+    /* relative errors, with the two columns of a complex conjugate pair sharing the estimate */
+    for (i=k;i<nv;i+=nb) {
+      nb  = (eps->eigi[i]!=0.0 && i+1<nv)? 2: 1;
+      nrm = (nb==2)? SlepcAbs(rnorm[i],rnorm[i+1]): rnorm[i];
+      for (j=i;j<i+nb;j++) eps->errest[j] = nrm/SlepcAbsEigenvalue(eps->eigr[j],eps->eigi[j]);
+    }
+
+    /* lock the leading converged Schur vectors */
+    while (eps->nconv<nv && eps->errest[eps->nconv]<eps->tol) eps->nconv++;
+    PetscCall(EPSMonitor(eps,eps->its,eps->nconv,eps->eigr,eps->eigi,eps->errest,nv));
+    PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,eps->nconv,eps->nev,&eps->reason,eps->stoppingctx));
+
+    if (eps->reason == EPS_CONVERGED_ITERATING) {
+      /* next block: iterates of the unconverged vectors, completed with random vectors */
+      if (eps->nconv<nv) {
+        PetscCall(BVSetActiveColumns(Y,eps->nconv,nv));
+        PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+        PetscCall(BVCopy(Y,eps->V));
+      }
+      nb = PetscMin(eps->nconv+bs,ncv);
+      for (i=nv;i<nb;i++) PetscCall(BVSetRandomColumn(eps->V,i));
+      PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nb));
+      PetscCall(BVOrthogonalize(eps->V,NULL));
+    }
+  }
+
+  PetscCall(STRestoreOperator(eps->st,&S));
+  PetscCall(PetscFree(rnorm));
+  PetscCall(DSSetDimensions(eps->ds,eps->nconv,0,0));
+  PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSolve_TS_Power(EPS eps)
 {
   EPS_POWER          *power = (EPS_POWER*)eps->data;
@@ -733,6 +848,7 @@ static PetscErrorCode EPSSetFromOptions_Power(EPS eps,PetscOptionItems *PetscOpt
 {
   EPS_POWER         *power = (EPS_POWER*)eps->data;
   PetscBool         flg,val;
+  PetscInt          bs;
   EPSPowerShiftType shift;
 
   PetscFunctionBegin;
@@ -749,6 +865,9 @@ static PetscErrorCode EPSSetFromOptions_Power(EPS eps,PetscOptionItems *PetscOpt
 
     PetscCall(PetscOptionsBool("-eps_power_sign_normalization","Normalize Bx with sign of first nonzero entry","EPSPowerSetSignNormalization",power->sign_normalization,&power->sign_normalization,&flg));
 
+    PetscCall(PetscOptionsInt("-eps_power_block_size","Number of vectors iterated simultaneously","EPSPowerSetBlockSize",power->bs,&bs,&flg));
+    if (flg) PetscCall(EPSPowerSetBlockSize(eps,bs));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1075,6 +1194,91 @@ PetscErrorCode EPSPowerGetSignNormalization(EPS eps,PetscBool *sign_normalizatio
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSPowerSetBlockSize_Power(EPS eps,PetscInt bs)
+{
+  EPS_POWER *power = (EPS_POWER*)eps->data;
+
+  PetscFunctionBegin;
+  if (bs == PETSC_DEFAULT || bs == PETSC_DECIDE) bs = 1;
+  else PetscCheck(bs>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of bs. Must be > 0");
+  if (power->bs != bs) {
+    power->bs  = bs;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSPowerSetBlockSize - Sets the number of vectors that are iterated
+   simultaneously in the power method.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  bs  - the block size
+
+   Options Database Key:
+.  -eps_power_block_size - Sets the block size
+
+   Notes:
+   With a block size larger than one, the solver performs subspace iteration
+   on a block of bs vectors: the operator is applied to all of them at once
+   and the eigenvalue approximations are obtained from a Schur-Rayleigh-Ritz
+   projection onto the block. Converged Schur vectors are locked, and the
+   block is completed with new random vectors as long as ncv allows it.
+   If ncv is not set, it defaults to nev+bs-1.
+
+   The block variant is available only for the linear power iteration with
+   constant shifts, in one-sided mode.
+
+   Level: advanced
+
+.seealso: EPSPowerGetBlockSize(), EPSSetDimensions()
+@*/
+PetscErrorCode EPSPowerSetBlockSize(EPS eps,PetscInt bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,bs,2);
+  PetscTryMethod(eps,"EPSPowerSetBlockSize_C",(EPS,PetscInt),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSPowerGetBlockSize_Power(EPS eps,PetscInt *bs)
+{
+  EPS_POWER *power = (EPS_POWER*)eps->data;
+
+  PetscFunctionBegin;
+  *bs = power->bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSPowerGetBlockSize - Gets the number of vectors that are iterated
+   simultaneously in the power method.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  bs - the block size
+
+   Level: advanced
+
+.seealso: EPSPowerSetBlockSize()
+@*/
+PetscErrorCode EPSPowerGetBlockSize(EPS eps,PetscInt *bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(bs,2);
+  PetscUseMethod(eps,"EPSPowerGetBlockSize_C",(EPS,PetscInt*),(eps,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSPowerSetSNES_Power(EPS eps,SNES snes)
 {
   EPS_POWER      *power = (EPS_POWER*)eps->data;
@@ -1158,6 +1362,8 @@ static PetscErrorCode EPSReset_Power(EPS eps)
 
   PetscFunctionBegin;
   if (power->snes) PetscCall(SNESReset(power->snes));
+  PetscCall(BVDestroy(&power->Y));
+  PetscCall(BVDestroy(&power->R));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1176,6 +1382,8 @@ static PetscErrorCode EPSDestroy_Power(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetUpdate_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSignNormalization_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSignNormalization_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetBlockSize_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSNES_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSNES_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -1198,7 +1406,10 @@ static PetscErrorCode EPSView_Power(EPS eps,PetscViewer viewer)
       PetscCall(PetscViewerASCIIPushTab(viewer));
       PetscCall(SNESView(power->snes,viewer));
       PetscCall(PetscViewerASCIIPopTab(viewer));
-    } else PetscCall(PetscViewerASCIIPrintf(viewer,"  %s shifts\n",EPSPowerShiftTypes[power->shift_type]));
+    } else {
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  %s shifts\n",EPSPowerShiftTypes[power->shift_type]));
+      if (power->bs>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  block size: %" PetscInt_FMT "\n",power->bs));
+    }
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1258,6 +1469,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Power(EPS eps)
   eps->ops->setdefaultst   = EPSSetDefaultST_Power;
   eps->stopping            = EPSStopping_Power;
   ctx->sign_normalization  = PETSC_TRUE;
+  ctx->bs                  = 1;
 
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetShiftType_C",EPSPowerSetShiftType_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetShiftType_C",EPSPowerGetShiftType_Power));
@@ -1267,6 +1479,8 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Power(EPS eps)
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetUpdate_C",EPSPowerGetUpdate_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSignNormalization_C",EPSPowerSetSignNormalization_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSignNormalization_C",EPSPowerGetSignNormalization_Power));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetBlockSize_C",EPSPowerSetBlockSize_Power));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetBlockSize_C",EPSPowerGetBlockSize_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerSetSNES_C",EPSPowerSetSNES_Power));
   PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSPowerGetSNES_C",EPSPowerGetSNES_Power));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -17,18 +17,35 @@
        Subspace iteration with Rayleigh-Ritz projection and locking,
        based on the SRRIT implementation.
 
+       Optionally, Chebyshev filtered subspace iteration (ChFSI) for
+       Hermitian problems, with per-vector polynomial degrees.
+
    References:
 
        [1] "Subspace Iteration in SLEPc", SLEPc Technical Report STR-3,
            available at https://slepc.upv.es.
+
+       [2] Y. Zhou, Y. Saad, M. L. Tiago, J. R. Chelikowsky, "Self-consistent-field
+           calculations using Chebyshev-filtered subspace iteration", J. Comput.
+           Phys. 219(1):172-184, 2006.
+
+       [3] J. Winkelmann, P. Springer, E. Di Napoli, "ChASE: Chebyshev accelerated
+           subspace iteration eigensolver for sequences of Hermitian eigenvalue
+           problems", ACM Trans. Math. Software 45(2):21, 2019.
 */
 
 #include <slepc/private/epsimpl.h>
+#include <slepcblaslapack.h>
 
 typedef struct {
   PetscBool estimatedrange;     /* the filter range was not set by the user */
+  PetscBool cheby;              /* use Chebyshev filtered subspace iteration */
+  PetscInt  deg;                /* maximum degree of the Chebyshev filter */
 } EPS_SUBSPACE;
 
+static PetscErrorCode EPSSolve_Subspace(EPS);
+static PetscErrorCode EPSSolve_Subspace_Chebyshev(EPS);
+
 static PetscErrorCode EPSSetUp_Subspace_Filter(EPS eps)
 {
   EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
@@ -59,16 +76,41 @@ static PetscErrorCode EPSSetUp_Subspace_Filter(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode EPSSetUp_Subspace_Chebyshev(EPS eps)
+{
+  PetscBool      isshift;
+  PetscScalar    sigma;
+
+  PetscFunctionBegin;
+  EPSCheckHermitianCondition(eps,PETSC_TRUE," with Chebyshev filtering");
+  EPSCheckStandardCondition(eps,PETSC_TRUE," with Chebyshev filtering");
+  PetscCheck(eps->which==EPS_SMALLEST_REAL || eps->which==EPS_LARGEST_REAL,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Chebyshev filtering supports only smallest or largest real eigenvalues");
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  PetscCall(STGetShift(eps->st,&sigma));
+  PetscCheck(isshift && sigma==0.0,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Chebyshev filtering requires STSHIFT with zero shift");
+  EPSCheckUnsupportedCondition(eps,EPS_FEATURE_REGION,PETSC_TRUE," with Chebyshev filtering");
+  PetscCall(EPSSetDimensions_Default(eps,&eps->nev,&eps->ncv,&eps->mpd));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSSetUp_Subspace(EPS eps)
 {
-  PetscBool isfilt;
+  EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool      isfilt;
 
   PetscFunctionBegin;
   EPSCheckDefinite(eps);
   EPSCheckNotStructured(eps);
   if (eps->max_it==PETSC_DETERMINE) eps->max_it = PetscMax(100,2*eps->n/eps->ncv);
-  if (!eps->which) PetscCall(EPSSetWhichEigenpairs_Default(eps));
-  if (eps->which==EPS_ALL) {
+  if (!eps->which) {
+    if (ctx->cheby) eps->which = EPS_SMALLEST_REAL;
+    else PetscCall(EPSSetWhichEigenpairs_Default(eps));
+  }
+  eps->ops->solve = EPSSolve_Subspace;
+  if (ctx->cheby) {
+    PetscCall(EPSSetUp_Subspace_Chebyshev(eps));
+    eps->ops->solve = EPSSolve_Subspace_Chebyshev;
+  } else if (eps->which==EPS_ALL) {
     if (eps->nev==0) eps->nev = 1;
     PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STFILTER,&isfilt));
     PetscCheck(isfilt,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Spectrum slicing not supported in this solver");
@@ -337,10 +379,434 @@ static PetscErrorCode EPSSolve_Subspace(EPS eps)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   EPSSubspaceChebyshevBound - Computes an upper bound of the spectrum of sgn*A
+   with a few steps of Lanczos, as the largest Ritz value plus the norm of the
+   last residual.
+*/
+static PetscErrorCode EPSSubspaceChebyshevBound(EPS eps,Mat A,PetscReal sgn,PetscReal *b)
+{
+  PetscInt       j,k=PetscMin(10,eps->n);
+  PetscReal      *d,*e,beta=0.0,rdummy;
+  PetscScalar    alpha,sdummy;
+  PetscBLASInt   n,ld=1,info;
+  PetscRandom    rand;
+  Vec            v,w,v0;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc2(k,&d,k,&e));
+  PetscCall(BVCreateVec(eps->V,&v));
+  PetscCall(VecDuplicate(v,&w));
+  PetscCall(VecDuplicate(v,&v0));
+  PetscCall(BVGetRandomContext(eps->V,&rand));
+  PetscCall(VecSetRandom(v,rand));
+  PetscCall(VecNormalize(v,NULL));
+  for (j=0;j<k;) {
+    PetscCall(MatMult(A,v,w));
+    if (j>0) PetscCall(VecAXPY(w,-beta,v0));
+    PetscCall(VecDot(w,v,&alpha));
+    PetscCall(VecAXPY(w,-alpha,v));
+    PetscCall(VecNorm(w,NORM_2,&beta));
+    d[j] = sgn*PetscRealPart(alpha);
+    e[j++] = beta;
+    if (beta==0.0) break;
+    PetscCall(VecCopy(v,v0));
+    PetscCall(VecAXPBY(v,1.0/beta,0.0,w));
+  }
+  PetscCall(PetscBLASIntCast(j,&n));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKsteqr",LAPACKsteqr_("N",&n,d,e,&sdummy,&ld,&rdummy,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("steqr",info);
+  *b = d[j-1]+beta;
+  PetscCall(PetscInfo(eps,"Estimated end of the spectrum for the Chebyshev filter: %g\n",(double)(sgn*(*b))));
+  PetscCall(PetscFree2(d,e));
+  PetscCall(VecDestroy(&v));
+  PetscCall(VecDestroy(&w));
+  PetscCall(VecDestroy(&v0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSSubspaceChebyshevFilter - Applies to columns l:m-1 of V the Chebyshev polynomials
+   of degree deg[l],...,deg[m-1] (sorted increasingly) that damp the interval [a,b] of the
+   spectrum of sgn*A, scaled to avoid overflow with the lower estimate a0. The three-term
+   recurrence acts on the block of columns that have not reached their degree yet, so
+   that each step is a single product of A times a block of vectors. On exit, the
+   filtered vectors are stored in V, while W1 and W2 are used as workspace.
+*/
+static PetscErrorCode EPSSubspaceChebyshevFilter(Mat A,PetscReal sgn,PetscReal a,PetscReal b,PetscReal a0,BV V,BV W1,BV W2,PetscInt l,PetscInt m,PetscInt *deg)
+{
+  PetscInt       i,s=l,t;
+  PetscReal      e,c,sigma,sigmanew,tau;
+  BV             X=V,Y=W1,Z=W2,T;
+
+  PetscFunctionBegin;
+  e     = (b-a)/2.0;
+  c     = (b+a)/2.0;
+  sigma = e/(a0-c);
+  tau   = 2.0/sigma;
+
+  /* Y = (sgn*A*X-c*X)*sigma/e */
+  PetscCall(BVSetActiveColumns(X,s,m));
+  PetscCall(BVSetActiveColumns(Y,s,m));
+  PetscCall(BVMatMult(X,A,Y));
+  PetscCall(BVScale(Y,sgn*sigma/e));
+  PetscCall(BVMult(Y,-c*sigma/e,1.0,X,NULL));
+
+  for (i=1;;i++) {
+    /* columns that have reached their degree are final, move them to V */
+    for (t=s;t<m && deg[t]<=i;t++);
+    if (t>s && Y!=V) {
+      PetscCall(BVSetActiveColumns(Y,s,t));
+      PetscCall(BVSetActiveColumns(V,s,t));
+      PetscCall(BVCopy(Y,V));
+    }
+    s = t;
+    if (s==m) break;
+    PetscCall(BVSetActiveColumns(X,s,m));
+    PetscCall(BVSetActiveColumns(Y,s,m));
+    PetscCall(BVSetActiveColumns(Z,s,m));
+
+    /* Z = (sgn*A*Y-c*Y)*2*sigmanew/e - sigma*sigmanew*X */
+    sigmanew = 1.0/(tau-sigma);
+    PetscCall(BVMatMult(Y,A,Z));
+    PetscCall(BVScale(Z,2.0*sgn*sigmanew/e));
+    PetscCall(BVMult(Z,-2.0*c*sigmanew/e,1.0,Y,NULL));
+    PetscCall(BVMult(Z,-sigma*sigmanew,1.0,X,NULL));
+    T = X; X = Y; Y = Z; Z = T;
+    sigma = sigmanew;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSolve_Subspace_Chebyshev(EPS eps)
+{
+  EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
+  Mat            A,H,Q,T;
+  BV             AV,R;
+  Vec            v;
+  PetscInt       i,k,ld,nv=eps->ncv,*deg,*perm,*sdeg;
+  PetscReal      sgn,a,a0,b,t,rho,*rsd;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc4(nv,&rsd,nv,&deg,nv,&perm,nv,&sdeg));
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  PetscCall(BVDuplicate(eps->V,&AV));
+  PetscCall(BVDuplicate(eps->V,&R));
+  PetscCall(STGetMatrix(eps->st,0,&A));
+
+  /* the filter always works with the smallest eigenvalues of sgn*A */
+  sgn = (eps->which==EPS_LARGEST_REAL)? -1.0: 1.0;
+  PetscCall(EPSSubspaceChebyshevBound(eps,A,sgn,&b));
+
+  /* Start from the recycled subspace of the previous solve, if there is no user initial space */
+  k = eps->nini;
+  if (!k && eps->nrec) {
+    k = PetscMin(eps->nrec,nv);
+    PetscCall(PetscInfo(eps,"Reusing %" PetscInt_FMT " vectors from the previous solve\n",k));
+    PetscCall(BVSetActiveColumns(eps->V,0,k));
+    PetscCall(BVOrthogonalize(eps->V,NULL));
+  }
+  eps->nrec = 0;
+  for (;k<nv;k++) {
+    PetscCall(BVSetRandomColumn(eps->V,k));
+    PetscCall(BVOrthonormalizeColumn(eps->V,k,PETSC_TRUE,NULL,NULL));
+  }
+
+  while (eps->reason == EPS_CONVERGED_ITERATING) {
+    eps->its++;
+    PetscCall(DSSetDimensions(eps->ds,nv,eps->nconv,0));
+
+    /* AV(:,idx) = A * V(:,idx) */
+    PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+    PetscCall(BVSetActiveColumns(AV,eps->nconv,nv));
+    PetscCall(BVMatMult(eps->V,A,AV));
+
+    /* T(:,idx) = V' * AV(:,idx) */
+    PetscCall(BVSetActiveColumns(eps->V,0,nv));
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(BVDot(AV,eps->V,H));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&H));
+    PetscCall(DSSetState(eps->ds,DS_STATE_RAW));
+
+    /* Solve projected problem */
+    PetscCall(DSSolve(eps->ds,eps->eigr,eps->eigi));
+    PetscCall(DSSort(eps->ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(eps->ds,eps->eigr,eps->eigi));
+
+    /* Update vectors V(:,idx) = V * U(:,idx) */
+    PetscCall(DSGetMat(eps->ds,DS_MAT_Q,&Q));
+    PetscCall(BVSetActiveColumns(AV,0,nv));
+    PetscCall(BVSetActiveColumns(R,0,nv));
+    PetscCall(BVMultInPlace(eps->V,Q,eps->nconv,nv));
+    PetscCall(BVMultInPlace(AV,Q,eps->nconv,nv));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_Q,&Q));
+    PetscCall(BVCopy(AV,R));
+
+    /* Convergence check, lock the leading converged Ritz vectors */
+    PetscCall(DSGetMat(eps->ds,DS_MAT_A,&T));
+    PetscCall(EPSSubspaceResidualNorms(R,eps->V,T,eps->nconv,nv,eps->eigi,rsd));
+    PetscCall(DSRestoreMat(eps->ds,DS_MAT_A,&T));
+    for (i=eps->nconv;i<nv;i++) PetscCall((*eps->converged)(eps,eps->eigr[i],eps->eigi[i],rsd[i],&eps->errest[i],eps->convergedctx));
+    for (k=eps->nconv;k<nv && eps->errest[k]<eps->tol;k++);
+    eps->nconv = k;
+
+    PetscCall(EPSMonitor(eps,eps->its,eps->nconv,eps->eigr,eps->eigi,eps->errest,nv));
+    PetscCall((*eps->stopping)(eps,eps->its,eps->max_it,eps->nconv,eps->nev,&eps->reason,eps->stoppingctx));
+    if (eps->reason != EPS_CONVERGED_ITERATING) break;
+
+    /* The filter damps [a,b], where a is the largest Ritz value of sgn*A */
+    a0 = sgn*PetscRealPart(eps->eigr[0]);
+    a  = sgn*PetscRealPart(eps->eigr[nv-1]);
+    if (b<=a) b = a+PetscMax(a-a0,PETSC_SQRT_MACHINE_EPSILON*PetscAbsReal(a));
+
+    /* Degree of each vector, enough to reduce its residual below tol given the
+       convergence factor of the Chebyshev polynomial at its Ritz value */
+    for (i=eps->nconv;i<nv;i++) {
+      t   = (sgn*PetscRealPart(eps->eigr[i])-(a+b)/2.0)/((b-a)/2.0);
+      rho = PetscAbsReal(t)+PetscSqrtReal(PetscMax(t*t-1.0,0.0));
+      if (eps->its==1 || rho<=1.0+PETSC_SQRT_MACHINE_EPSILON) deg[i] = ctx->deg;
+      else deg[i] = PetscMin(ctx->deg,PetscMax(1,(PetscInt)PetscCeilReal(PetscLogReal(eps->errest[i]/eps->tol)/PetscLogReal(rho))));
+      perm[i-eps->nconv] = i-eps->nconv;
+    }
+
+    /* Sort the vectors by increasing degree, so that the filter acts on contiguous blocks */
+    PetscCall(PetscSortIntWithPermutation(nv-eps->nconv,deg+eps->nconv,perm));
+    for (i=0;i<nv-eps->nconv;i++) sdeg[eps->nconv+i] = deg[eps->nconv+perm[i]];
+    for (i=0;i<nv-eps->nconv;i++) if (perm[i]!=i) break;
+    if (i<nv-eps->nconv) {
+      for (i=0;i<nv-eps->nconv;i++) {
+        PetscCall(BVGetColumn(eps->V,eps->nconv+perm[i],&v));
+        PetscCall(BVInsertVec(R,eps->nconv+i,v));
+        PetscCall(BVRestoreColumn(eps->V,eps->nconv+perm[i],&v));
+      }
+      PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+      PetscCall(BVSetActiveColumns(R,eps->nconv,nv));
+      PetscCall(BVCopy(R,eps->V));
+    }
+    PetscCall(PetscInfo(eps,"Chebyshev filter degrees from %" PetscInt_FMT " to %" PetscInt_FMT "\n",sdeg[eps->nconv],sdeg[nv-1]));
+
+    /* V(:,idx) = p(A)*V(:,idx), then orthonormalize */
+    PetscCall(EPSSubspaceChebyshevFilter(A,sgn,a,b,a0,eps->V,AV,R,eps->nconv,nv,sdeg));
+    PetscCall(BVSetActiveColumns(eps->V,eps->nconv,nv));
+    PetscCall(BVOrthogonalize(eps->V,NULL));
+  }
+
+  /* Keep the converged Ritz vectors and nrecextra more to start the next solve, see EPSSetRecycle() */
+  if (eps->recycle) eps->nrec = PetscMin(eps->nconv+eps->nrecextra,nv);
+
+  PetscCall(PetscFree4(rsd,deg,perm,sdeg));
+  PetscCall(BVDestroy(&AV));
+  PetscCall(BVDestroy(&R));
+  PetscCall(DSTruncate(eps->ds,eps->nconv,PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceSetChebyshev_Subspace(EPS eps,PetscBool cheby)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  if (ctx->cheby != cheby) {
+    ctx->cheby = cheby;
+    eps->state = EPS_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceSetChebyshev - Activates the Chebyshev filtered subspace iteration
+   (ChFSI) variant of the subspace solver.
+
+   Logically Collective
+
+   Input Parameters:
++  eps   - the eigenproblem solver context
+-  cheby - whether Chebyshev filtering is used or not
+
+   Options Database Key:
+.  -eps_subspace_chebyshev - Activates Chebyshev filtering
+
+   Notes:
+   This variant is intended for standard Hermitian problems in which the smallest
+   (or largest) real eigenvalues are wanted, possibly many of them. In each iteration,
+   a Chebyshev polynomial that damps the unwanted part of the spectrum is applied to
+   the whole subspace with products of the matrix times a block of vectors. The bounds
+   of the polynomial are taken from the Ritz values and from a few Lanczos steps, and
+   the degree is chosen for each vector according to its residual, so that the vectors
+   that are close to convergence require fewer products. The maximum degree can be set
+   with EPSSubspaceSetChebyshevDegree().
+
+   If recycling has been activated with EPSSetRecycle(), when EPSSolve() is called
+   again with the same solver object, e.g., after changing the matrix with
+   EPSSetOperators() within a self-consistent iteration, the recycled vectors of the
+   previous solve are used as the leading part of the initial subspace, unless an
+   initial space has been provided with EPSSetInitialSpace().
+
+   Level: advanced
+
+.seealso: EPSSubspaceGetChebyshev(), EPSSubspaceSetChebyshevDegree(), EPSSetWhichEigenpairs()
+@*/
+PetscErrorCode EPSSubspaceSetChebyshev(EPS eps,PetscBool cheby)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,cheby,2);
+  PetscTryMethod(eps,"EPSSubspaceSetChebyshev_C",(EPS,PetscBool),(eps,cheby));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceGetChebyshev_Subspace(EPS eps,PetscBool *cheby)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  *cheby = ctx->cheby;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceGetChebyshev - Returns the flag indicating whether the Chebyshev
+   filtered subspace iteration variant is used.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  cheby - the flag
+
+   Level: advanced
+
+.seealso: EPSSubspaceSetChebyshev()
+@*/
+PetscErrorCode EPSSubspaceGetChebyshev(EPS eps,PetscBool *cheby)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(cheby,2);
+  PetscUseMethod(eps,"EPSSubspaceGetChebyshev_C",(EPS,PetscBool*),(eps,cheby));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceSetChebyshevDegree_Subspace(EPS eps,PetscInt deg)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  if (deg == PETSC_DEFAULT || deg == PETSC_DECIDE) ctx->deg = 20;
+  else {
+    PetscCheck(deg>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of degree. Must be > 0");
+    ctx->deg = deg;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceSetChebyshevDegree - Sets the maximum degree of the Chebyshev
+   polynomials used in the Chebyshev filtered subspace iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  eps - the eigenproblem solver context
+-  deg - the maximum degree
+
+   Options Database Key:
+.  -eps_subspace_chebyshev_degree - Sets the maximum degree
+
+   Notes:
+   This degree is used for all vectors in the first iteration. Afterwards,
+   each vector gets the degree that is estimated to be enough for convergence,
+   never larger than deg. The default is 20.
+
+   Level: advanced
+
+.seealso: EPSSubspaceGetChebyshevDegree(), EPSSubspaceSetChebyshev()
+@*/
+PetscErrorCode EPSSubspaceSetChebyshevDegree(EPS eps,PetscInt deg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,deg,2);
+  PetscTryMethod(eps,"EPSSubspaceSetChebyshevDegree_C",(EPS,PetscInt),(eps,deg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSubspaceGetChebyshevDegree_Subspace(EPS eps,PetscInt *deg)
+{
+  EPS_SUBSPACE *ctx = (EPS_SUBSPACE*)eps->data;
+
+  PetscFunctionBegin;
+  *deg = ctx->deg;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSubspaceGetChebyshevDegree - Gets the maximum degree of the Chebyshev
+   polynomials used in the Chebyshev filtered subspace iteration.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigenproblem solver context
+
+   Output Parameter:
+.  deg - the maximum degree
+
+   Level: advanced
+
+.seealso: EPSSubspaceSetChebyshevDegree()
+@*/
+PetscErrorCode EPSSubspaceGetChebyshevDegree(EPS eps,PetscInt *deg)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscAssertPointer(deg,2);
+  PetscUseMethod(eps,"EPSSubspaceGetChebyshevDegree_C",(EPS,PetscInt*),(eps,deg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSSetFromOptions_Subspace(EPS eps,PetscOptionItems *PetscOptionsObject)
+{
+  EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool      cheby,flg;
+  PetscInt       deg;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"EPS Subspace Options");
+
+    PetscCall(PetscOptionsBool("-eps_subspace_chebyshev","Use Chebyshev filtered subspace iteration","EPSSubspaceSetChebyshev",ctx->cheby,&cheby,&flg));
+    if (flg) PetscCall(EPSSubspaceSetChebyshev(eps,cheby));
+
+    PetscCall(PetscOptionsInt("-eps_subspace_chebyshev_degree","Maximum degree of the Chebyshev filter","EPSSubspaceSetChebyshevDegree",ctx->deg,&deg,&flg));
+    if (flg) PetscCall(EPSSubspaceSetChebyshevDegree(eps,deg));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode EPSView_Subspace(EPS eps,PetscViewer viewer)
+{
+  EPS_SUBSPACE   *ctx = (EPS_SUBSPACE*)eps->data;
+  PetscBool      isascii;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
+  if (isascii && ctx->cheby) PetscCall(PetscViewerASCIIPrintf(viewer,"  using Chebyshev filtering, maximum degree %" PetscInt_FMT "\n",ctx->deg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode EPSDestroy_Subspace(EPS eps)
 {
   PetscFunctionBegin;
   PetscCall(PetscFree(eps->data));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshev_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshev_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshevDegree_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshevDegree_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -351,6 +817,7 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Subspace(EPS eps)
   PetscFunctionBegin;
   PetscCall(PetscNew(&ctx));
   eps->data  = (void*)ctx;
+  ctx->deg   = 20;
 
   eps->useds = PETSC_TRUE;
   eps->categ = EPS_CATEGORY_OTHER;
@@ -358,8 +825,15 @@ SLEPC_EXTERN PetscErrorCode EPSCreate_Subspace(EPS eps)
   eps->ops->solve          = EPSSolve_Subspace;
   eps->ops->setup          = EPSSetUp_Subspace;
   eps->ops->setupsort      = EPSSetUpSort_Subspace;
+  eps->ops->setfromoptions = EPSSetFromOptions_Subspace;
   eps->ops->destroy        = EPSDestroy_Subspace;
+  eps->ops->view           = EPSView_Subspace;
   eps->ops->backtransform  = EPSBackTransform_Default;
   eps->ops->computevectors = EPSComputeVectors_Schur;
+
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshev_C",EPSSubspaceSetChebyshev_Subspace));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshev_C",EPSSubspaceGetChebyshev_Subspace));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceSetChebyshevDegree_C",EPSSubspaceSetChebyshevDegree_Subspace));
+  PetscCall(PetscObjectComposeFunction((PetscObject)eps,"EPSSubspaceGetChebyshevDegree_C",EPSSubspaceGetChebyshevDegree_Subspace));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
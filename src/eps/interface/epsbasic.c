@@ -78,6 +78,10 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->trackall        = PETSC_FALSE;
   eps->purify          = PETSC_TRUE;
   eps->twosided        = PETSC_FALSE;
+  eps->recycle         = PETSC_FALSE;
+  eps->nrecextra       = 0;
+  eps->ckptviewer      = NULL;
+  eps->ckptevery       = 1;
 
   eps->converged       = EPSConvergedRelative;
   eps->convergeduser   = NULL;
@@ -114,6 +118,7 @@ PetscErrorCode EPSCreate(MPI_Comm comm,EPS *outeps)
   eps->categ           = EPS_CATEGORY_KRYLOV;
   eps->nconv           = 0;
   eps->its             = 0;
+  eps->nrec            = 0;
   eps->nloc            = 0;
   eps->nrma            = 0.0;
   eps->nrmb            = 0.0;
@@ -314,6 +319,7 @@ PetscErrorCode EPSReset(EPS eps)
   PetscCall(BVDestroy(&eps->W));
   PetscCall(VecDestroyVecs(eps->nwork,&eps->work));
   eps->nwork = 0;
+  eps->nrec  = 0;
   eps->state = EPS_STATE_INITIAL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -351,6 +357,7 @@ PetscErrorCode EPSDestroy(EPS *eps)
   if ((*eps)->convergeddestroy) PetscCall((*(*eps)->convergeddestroy)(&(*eps)->convergedctx));
   if ((*eps)->stoppingdestroy) PetscCall((*(*eps)->stoppingdestroy)(&(*eps)->stoppingctx));
   PetscCall(EPSMonitorCancel(*eps));
+  PetscCall(PetscViewerDestroy(&(*eps)->ckptviewer));
   PetscCall(PetscHeaderDestroy(eps));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -83,8 +83,9 @@ PetscErrorCode EPSMonitorSetFromOptions(EPS eps,const char opt[],const char name
 @*/
 PetscErrorCode EPSSetFromOptions(EPS eps)
 {
-  char           type[256];
+  char           type[256],ckptname[PETSC_MAX_PATH_LEN];
   PetscBool      set,flg,flg1,flg2,flg3,bval;
+  PetscViewer    viewer;
   PetscReal      r,array[2]={0,0};
   PetscScalar    s;
   PetscInt       i,j,k;
@@ -213,6 +214,23 @@ PetscErrorCode EPSSetFromOptions(EPS eps)
     if (flg) PetscCall(EPSSetPurify(eps,bval));
     PetscCall(PetscOptionsBool("-eps_two_sided","Use two-sided variant (to compute left eigenvectors)","EPSSetTwoSided",eps->twosided,&bval,&flg));
     if (flg) PetscCall(EPSSetTwoSided(eps,bval));
+    bval = eps->recycle;
+    i = eps->nrecextra;
+    PetscCall(PetscOptionsBool("-eps_recycle","Recycle the converged subspace in subsequent solves","EPSSetRecycle",bval,&bval,&flg));
+    PetscCall(PetscOptionsInt("-eps_recycle_extra","Number of extra Ritz vectors kept for recycling","EPSSetRecycle",i,&i,&flg1));
+    if (flg || flg1) PetscCall(EPSSetRecycle(eps,bval,i));
+    i = eps->ckptevery;
+    PetscCall(PetscOptionsString("-eps_checkpoint","Binary file where checkpoints are written","EPSSetCheckpoint",NULL,ckptname,sizeof(ckptname),&flg));
+    PetscCall(PetscOptionsInt("-eps_checkpoint_every","Number of restarts between checkpoints","EPSSetCheckpoint",i,&i,&flg1));
+    if (flg) {
+      PetscCall(PetscViewerCreate(PetscObjectComm((PetscObject)eps),&viewer));
+      PetscCall(PetscViewerSetType(viewer,PETSCVIEWERBINARY));
+      PetscCall(PetscViewerBinarySetSkipInfo(viewer,PETSC_TRUE));
+      PetscCall(PetscViewerFileSetMode(viewer,FILE_MODE_WRITE));
+      PetscCall(PetscViewerFileSetName(viewer,ckptname));
+      PetscCall(EPSSetCheckpoint(eps,viewer,i));
+      PetscCall(PetscViewerDestroy(&viewer));
+    } else if (flg1) PetscCall(EPSSetCheckpoint(eps,eps->ckptviewer,i));
 
     /* -----------------------------------------------------------------------*/
     /*
@@ -1364,6 +1382,176 @@ PetscErrorCode EPSGetTrueResidual(EPS eps,PetscBool *trueres)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   EPSSetRecycle - Specifies whether the invariant subspace computed in a solve
+   must be kept and used to start the next solve.
+
+   Logically Collective
+
+   Input Parameters:
++  eps     - the eigensolver context
+.  recycle - whether the subspace is recycled or not
+-  nextra  - number of additional Ritz vectors to keep, besides the converged ones
+
+   Options Database Keys:
++  -eps_recycle <boolean> - Sets/resets the recycle flag
+-  -eps_recycle_extra <nextra> - Sets the number of extra Ritz vectors
+
+   Notes:
+   This is intended for sequences of related eigenproblems, such as those arising
+   in nonlinear iterations or parameter sweeps, where the matrices change slightly
+   from one solve to the next. When recycle=PETSC_TRUE, the basis of the converged
+   invariant subspace, together with nextra additional Ritz vectors, is retained
+   in the solver at the end of EPSSolve(). In the next call to EPSSolve(), a
+   Rayleigh-Ritz projection of the (possibly updated) operator onto this subspace
+   is computed, the Ritz pairs that already satisfy the convergence criterion are
+   locked, and the iteration is started from the remaining wanted Ritz vectors.
+
+   The recycled subspace is discarded if an initial space is provided with
+   EPSSetInitialSpace(), or if the problem dimension changes. Currently, only the
+   Krylov-Schur solver exploits the recycled subspace, in the default variant and
+   with Ritz (not harmonic) extraction, and the Chebyshev filtered variant of
+   EPSSUBSPACE, which uses it as the leading part of the initial subspace.
+
+   Use PETSC_CURRENT to retain the current value of nextra, or PETSC_DETERMINE
+   to set it to the default value (zero).
+
+   Level: advanced
+
+.seealso: EPSGetRecycle(), EPSSetInitialSpace()
+@*/
+PetscErrorCode EPSSetRecycle(EPS eps,PetscBool recycle,PetscInt nextra)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveBool(eps,recycle,2);
+  PetscValidLogicalCollectiveInt(eps,nextra,3);
+  if (nextra == PETSC_DETERMINE) eps->nrecextra = 0;
+  else if (nextra != PETSC_CURRENT) {
+    PetscCheck(nextra>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"Number of extra vectors must be non-negative");
+    eps->nrecextra = nextra;
+  }
+  eps->recycle = recycle;
+  if (!recycle) eps->nrec = 0;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetRecycle - Returns the flag indicating whether the computed invariant
+   subspace is recycled in subsequent solves, and the number of extra Ritz vectors.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameters:
++  recycle - the returned flag
+-  nextra  - the number of additional Ritz vectors
+
+   Level: advanced
+
+.seealso: EPSSetRecycle()
+@*/
+PetscErrorCode EPSGetRecycle(EPS eps,PetscBool *recycle,PetscInt *nextra)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (recycle) *recycle = eps->recycle;
+  if (nextra) *nextra = eps->nrecextra;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSSetCheckpoint - Sets a binary viewer where the state of the solver is
+   periodically saved, so that the computation can be resumed later.
+
+   Logically Collective
+
+   Input Parameters:
++  eps    - the eigensolver context
+.  viewer - a binary viewer open for writing, or NULL to disable checkpointing
+-  every  - number of restarts between two consecutive checkpoints
+
+   Options Database Keys:
++  -eps_checkpoint <file> - Writes checkpoints to the given binary file
+-  -eps_checkpoint_every <every> - Sets the number of restarts between checkpoints
+
+   Notes:
+   A checkpoint is written only at restart boundaries, once every 'every' restarts,
+   and contains the basis vectors retained at the restart, that is, the locked Schur
+   vectors and the kept Ritz vectors, so that the cost is that of writing a few
+   vectors with VecView(). The projected matrix is not stored, since it can be
+   recovered from the saved basis with a Rayleigh-Ritz projection when the solve
+   is resumed with EPSLoadCheckpoint(). Collective MPI-IO is used if the viewer
+   has been configured with PetscViewerBinarySetUseMPIIO().
+
+   The viewer only provides the file name and the MPI-IO setting. Each checkpoint
+   is written to a temporary file, <file>.tmp, that then replaces the file, so
+   the file contains only the last checkpoint and it is always complete, even if
+   the run is interrupted while writing. To avoid leaving a <file>.info companion
+   file, create the viewer with PetscViewerBinarySetSkipInfo(), as is done with
+   -eps_checkpoint.
+   Currently, only the Krylov-Schur solver writes checkpoints, in the default
+   variant and with Ritz (not harmonic) extraction.
+
+   Use PETSC_CURRENT to retain the current value of every, or PETSC_DETERMINE
+   to set it to the default value (one).
+
+   Level: advanced
+
+.seealso: EPSGetCheckpoint(), EPSLoadCheckpoint(), EPSSetRecycle()
+@*/
+PetscErrorCode EPSSetCheckpoint(EPS eps,PetscViewer viewer,PetscInt every)
+{
+  PetscBool isbinary;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidLogicalCollectiveInt(eps,every,3);
+  if (viewer) {
+    PetscValidHeaderSpecific(viewer,PETSC_VIEWER_CLASSID,2);
+    PetscCheckSameComm(eps,1,viewer,2);
+    PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERBINARY,&isbinary));
+    PetscCheck(isbinary,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Checkpoints can only be written to a binary viewer");
+    PetscCall(PetscObjectReference((PetscObject)viewer));
+  }
+  PetscCall(PetscViewerDestroy(&eps->ckptviewer));
+  eps->ckptviewer = viewer;
+  if (every == PETSC_DETERMINE) eps->ckptevery = 1;
+  else if (every != PETSC_CURRENT) {
+    PetscCheck(every>0,PetscObjectComm((PetscObject)eps),PETSC_ERR_ARG_OUTOFRANGE,"The number of restarts between checkpoints must be positive");
+    eps->ckptevery = every;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSGetCheckpoint - Returns the viewer used for checkpointing and the number
+   of restarts between two consecutive checkpoints.
+
+   Not Collective
+
+   Input Parameter:
+.  eps - the eigensolver context
+
+   Output Parameters:
++  viewer - the viewer, or NULL if checkpointing is disabled
+-  every  - number of restarts between checkpoints
+
+   Level: advanced
+
+.seealso: EPSSetCheckpoint()
+@*/
+PetscErrorCode EPSGetCheckpoint(EPS eps,PetscViewer *viewer,PetscInt *every)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  if (viewer) *viewer = eps->ckptviewer;
+  if (every) *every = eps->ckptevery;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    EPSSetTrackAll - Specifies if the solver must compute the residual norm of all
    approximate eigenpairs or not.
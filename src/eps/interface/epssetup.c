@@ -743,7 +743,11 @@ PetscErrorCode EPSAllocateSolution(EPS eps,PetscInt extra)
     PetscCall(STMatCreateVecsEmpty(eps->st,&t,NULL));
     PetscCall(BVSetSizesFromVec(eps->V,t,requested));
     PetscCall(VecDestroy(&t));
-  } else PetscCall(BVResize(eps->V,requested,PETSC_FALSE));
+  } else {
+    /* keep the subspace to be recycled, if any */
+    PetscCall(BVResize(eps->V,requested,eps->nrec?PETSC_TRUE:PETSC_FALSE));
+    eps->nrec = PetscMin(eps->nrec,requested);
+  }
 
   /* allocate W */
   if (eps->twosided) {
@@ -898,3 +898,249 @@ PetscErrorCode EPSGetLeftStartVector(EPS eps,PetscInt i,PetscBool *breakdown)
   PetscCall(BVScaleColumn(eps->W,i,1.0/norm));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   EPSGetRecycledSubspace - Prepare the initial state of a Krylov solver from the
+   subspace that was kept in the first eps->nrec columns of V at the end of the
+   previous solve, see EPSSetRecycle().
+
+   Collective
+
+   Input Parameters:
+.  eps - the eigensolver context
+
+   Notes:
+   A Rayleigh-Ritz projection with the current operator is computed on the
+   recycled subspace. The leading Ritz pairs that satisfy the convergence criterion
+   are locked, that is, the Schur vectors are stored in the first columns of V and
+   the corresponding part of the Schur form is stored in the leading part of the DS,
+   and eps->nconv is set accordingly. The next column of V is the starting vector
+   of the new Krylov decomposition, computed as the sum of the remaining wanted
+   Ritz vectors, or a random vector if all of them have been locked.
+*/
+PetscErrorCode EPSGetRecycledSubspace(EPS eps)
+{
+  PetscInt       i,j,k,b,m,nw,ld,ld2;
+  PetscScalar    *S,*A,*q,re,im;
+  PetscReal      *rsd,*T;
+  PetscBool      compact,isshift,breakdown;
+  SlepcSC        sc,sc0;
+  DS             ds;
+  BV             AW;
+  Mat            Op,H,Q;
+
+  PetscFunctionBegin;
+  m = PetscMin(eps->nrec,eps->ncv-1);
+  eps->nrec = 0;
+  if (m<=0) {
+    PetscCall(EPSGetStartVector(eps,0,NULL));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
+  /* Rayleigh-Ritz projection of the current operator onto the recycled subspace */
+  PetscCall(BVSetActiveColumns(eps->V,0,m));
+  PetscCall(BVOrthogonalize(eps->V,NULL));
+  PetscCall(BVDuplicateResize(eps->V,m,&AW));
+  PetscCall(STGetOperator(eps->st,&Op));
+  PetscCall(BVMatMult(eps->V,Op,AW));
+  PetscCall(STRestoreOperator(eps->st,&Op));
+  PetscCall(DSCreate(PetscObjectComm((PetscObject)eps),&ds));
+  PetscCall(DSSetType(ds,eps->ishermitian?DSHEP:DSNHEP));
+  PetscCall(DSAllocate(ds,m));
+  PetscCall(DSSetDimensions(ds,m,0,0));
+  PetscCall(DSGetSlepcSC(eps->ds,&sc0));
+  PetscCall(DSGetSlepcSC(ds,&sc));
+  *sc = *sc0;
+  PetscCall(DSGetMat(ds,DS_MAT_A,&H));
+  PetscCall(BVDot(AW,eps->V,H));
+  PetscCall(DSRestoreMat(ds,DS_MAT_A,&H));
+  PetscCall(DSSetState(ds,DS_STATE_RAW));
+  PetscCall(DSSolve(ds,eps->eigr,eps->eigi));
+  PetscCall(DSSort(ds,eps->eigr,eps->eigi,NULL,NULL,NULL));
+  PetscCall(DSSynchronize(ds,eps->eigr,eps->eigi));
+
+  /* Schur vectors V <- V*Q and residuals AW <- Op*V*Q - V*Q*S */
+  PetscCall(DSGetMat(ds,DS_MAT_Q,&Q));
+  PetscCall(BVMultInPlace(eps->V,Q,0,m));
+  PetscCall(BVMultInPlace(AW,Q,0,m));
+  PetscCall(DSRestoreMat(ds,DS_MAT_Q,&Q));
+  PetscCall(DSGetMat(ds,DS_MAT_A,&H));
+  PetscCall(BVMult(AW,-1.0,1.0,eps->V,H));
+  PetscCall(DSRestoreMat(ds,DS_MAT_A,&H));
+  PetscCall(PetscMalloc1(m,&rsd));
+  for (i=0;i<m;i++) PetscCall(BVNormColumnBegin(AW,i,NORM_2,rsd+i));
+  for (i=0;i<m;i++) PetscCall(BVNormColumnEnd(AW,i,NORM_2,rsd+i));
+
+  /* Lock the leading converged Ritz pairs, without breaking 2x2 blocks */
+  PetscCall(PetscObjectTypeCompare((PetscObject)eps->st,STSHIFT,&isshift));
+  for (k=0;k<m;k+=b) {
+#if !defined(PETSC_USE_COMPLEX)
+    b = (eps->eigi[k]!=0.0)? 2: 1;
+#else
+    b = 1;
+#endif
+    re = eps->eigr[k];
+    im = eps->eigi[k];
+    if (isshift || eps->conv==EPS_CONV_NORM) PetscCall(STBackTransform(eps->st,1,&re,&im));
+    PetscCall((*eps->converged)(eps,re,im,(b==2)?SlepcAbs(rsd[k],rsd[k+1]):rsd[k],&eps->errest[k],eps->convergedctx));
+    if (eps->errest[k]>=eps->tol) break;
+    if (b==2) eps->errest[k+1] = eps->errest[k];
+  }
+  k = PetscMin(k,m);
+  PetscCall(PetscInfo(eps,"Recycled subspace of dimension %" PetscInt_FMT ", %" PetscInt_FMT " Ritz pairs locked\n",m,k));
+
+  /* Store the locked part of the Schur form in the DS of the solver */
+  PetscCall(DSGetLeadingDimension(eps->ds,&ld));
+  PetscCall(DSGetLeadingDimension(ds,&ld2));
+  PetscCall(DSGetCompact(eps->ds,&compact));
+  PetscCall(DSGetArray(ds,DS_MAT_A,&S));
+  if (compact) {
+    PetscCall(DSGetArrayReal(eps->ds,DS_MAT_T,&T));
+    for (i=0;i<k;i++) {
+      T[i]    = PetscRealPart(S[i+i*ld2]);
+      T[i+ld] = 0.0;
+    }
+    PetscCall(DSRestoreArrayReal(eps->ds,DS_MAT_T,&T));
+  } else {
+    PetscCall(DSGetArray(eps->ds,DS_MAT_A,&A));
+    for (j=0;j<k;j++) {
+      for (i=0;i<=PetscMin(j+1,k-1);i++) A[i+j*ld] = S[i+j*ld2];
+      for (;i<ld;i++) A[i+j*ld] = 0.0;
+    }
+    PetscCall(DSRestoreArray(eps->ds,DS_MAT_A,&A));
+  }
+  PetscCall(DSRestoreArray(ds,DS_MAT_A,&S));
+  eps->nconv = k;
+
+  /* Starting vector, sum of the unconverged wanted Ritz vectors */
+  breakdown = PETSC_TRUE;
+  if (k<m) {
+    nw = PetscMax(k+1,PetscMin(eps->nev,m));
+    PetscCall(PetscCalloc1(m,&q));
+    for (i=k;i<nw;i++) q[i] = 1.0;
+    PetscCall(BVSetActiveColumns(eps->V,0,m));
+    PetscCall(BVMultColumn(eps->V,1.0,0.0,m,q));
+    PetscCall(BVCopyColumn(eps->V,m,k));
+    PetscCall(PetscFree(q));
+    PetscCall(BVOrthonormalizeColumn(eps->V,k,PETSC_TRUE,NULL,&breakdown));
+  }
+  if (breakdown) PetscCall(EPSGetStartVector(eps,k,NULL));
+
+  PetscCall(PetscFree(rsd));
+  PetscCall(DSDestroy(&ds));
+  PetscCall(BVDestroy(&AW));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   EPSCheckpointWrite - Writes a checkpoint with the first m columns of V to
+   the file of the checkpoint viewer, see EPSSetCheckpoint().
+
+   The record is written to a temporary file that then replaces the checkpoint
+   file, so that the file always contains one complete checkpoint, even if the
+   run is interrupted while writing. The record ends with a copy of the class id
+   that is used to validate it when loading.
+*/
+PetscErrorCode EPSCheckpointWrite(EPS eps,PetscInt m)
+{
+  PetscInt    i,header[4],trailer=EPS_CHECKPOINT_CLASSID;
+  PetscMPIInt rank;
+  PetscBool   mpiio;
+  const char  *name;
+  char        tmpname[PETSC_MAX_PATH_LEN];
+  PetscViewer viewer;
+  MPI_Comm    comm;
+  Vec         v;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)eps,&comm));
+  PetscCall(PetscViewerFileGetName(eps->ckptviewer,&name));
+  PetscCheck(name,comm,PETSC_ERR_ORDER,"The checkpoint viewer does not have a file name");
+  PetscCall(PetscSNPrintf(tmpname,sizeof(tmpname),"%s.tmp",name));
+  PetscCall(PetscViewerBinaryGetUseMPIIO(eps->ckptviewer,&mpiio));
+  PetscCall(PetscViewerCreate(comm,&viewer));
+  PetscCall(PetscViewerSetType(viewer,PETSCVIEWERBINARY));
+  PetscCall(PetscViewerBinarySetSkipInfo(viewer,PETSC_TRUE));
+  PetscCall(PetscViewerBinarySetUseMPIIO(viewer,mpiio));
+  PetscCall(PetscViewerFileSetMode(viewer,FILE_MODE_WRITE));
+  PetscCall(PetscViewerFileSetName(viewer,tmpname));
+
+  header[0] = EPS_CHECKPOINT_CLASSID;
+  header[1] = eps->its;
+  header[2] = eps->nconv;
+  header[3] = m;
+  PetscCall(PetscViewerBinaryWrite(viewer,header,4,PETSC_INT));
+  for (i=0;i<m;i++) {
+    PetscCall(BVGetColumn(eps->V,i,&v));
+    PetscCall(VecView(v,viewer));
+    PetscCall(BVRestoreColumn(eps->V,i,&v));
+  }
+  PetscCall(PetscViewerBinaryWrite(viewer,&trailer,1,PETSC_INT));
+  PetscCall(PetscViewerDestroy(&viewer));
+
+  /* replace the previous checkpoint once the new one is complete */
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  if (!rank) PetscCheck(!rename(tmpname,name),PETSC_COMM_SELF,PETSC_ERR_FILE_WRITE,"Unable to rename the checkpoint file %s",tmpname);
+  PetscCallMPI(MPI_Barrier(comm));
+  PetscCall(PetscInfo(eps,"Checkpoint with %" PetscInt_FMT " vectors written at iteration %" PetscInt_FMT "\n",m,eps->its));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   EPSLoadCheckpoint - Loads the checkpoint stored in a binary viewer, so
+   that the next call to EPSSolve() resumes the computation from it.
+
+   Collective
+
+   Input Parameters:
++  eps    - the eigensolver context
+-  viewer - a binary viewer open for reading
+
+   Notes:
+   The viewer must contain a checkpoint written with EPSSetCheckpoint() for the
+   same problem. The eigensolver must be fully configured, since this function
+   calls EPSSetUp(). The saved basis is used by the next EPSSolve() in the same
+   way as a recycled subspace, see EPSSetRecycle(): the Ritz pairs that satisfy
+   the convergence criterion are locked and the iteration continues from the
+   remaining ones.
+
+   An error is raised if the checkpoint is incomplete, which can only happen if
+   the file has been truncated after being written.
+
+   Level: advanced
+
+.seealso: EPSSetCheckpoint(), EPSSetRecycle()
+@*/
+PetscErrorCode EPSLoadCheckpoint(EPS eps,PetscViewer viewer)
+{
+  PetscInt  i,m,count,header[4],trailer=0;
+  PetscBool isbinary;
+  Vec       v,w;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(eps,EPS_CLASSID,1);
+  PetscValidHeaderSpecific(viewer,PETSC_VIEWER_CLASSID,2);
+  PetscCheckSameComm(eps,1,viewer,2);
+  PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERBINARY,&isbinary));
+  PetscCheck(isbinary,PetscObjectComm((PetscObject)eps),PETSC_ERR_SUP,"Checkpoints can only be read from a binary viewer");
+  PetscCall(EPSSetUp(eps));
+  PetscCall(PetscViewerBinaryRead(viewer,header,4,&count,PETSC_INT));
+  PetscCheck(count==4,PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"No checkpoint found in the binary file");
+  PetscCheck(header[0]==EPS_CHECKPOINT_CLASSID,PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"Not an EPS checkpoint in the binary file");
+  PetscCheck(header[3]>=0,PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"Corrupted EPS checkpoint in the binary file");
+  m = PetscMin(header[3],eps->ncv-1);
+  PetscCall(BVCreateVec(eps->V,&w));
+  for (i=0;i<header[3];i++) {
+    if (i<m) {
+      PetscCall(BVGetColumn(eps->V,i,&v));
+      PetscCall(VecLoad(v,viewer));
+      PetscCall(BVRestoreColumn(eps->V,i,&v));
+    } else PetscCall(VecLoad(w,viewer));
+  }
+  PetscCall(VecDestroy(&w));
+  PetscCall(PetscViewerBinaryRead(viewer,&trailer,1,&count,PETSC_INT));
+  PetscCheck(count==1 && trailer==EPS_CHECKPOINT_CLASSID,PetscObjectComm((PetscObject)eps),PETSC_ERR_FILE_UNEXPECTED,"Incomplete EPS checkpoint in the binary file");
+  eps->nrec = m;
+  PetscCall(PetscInfo(eps,"Loaded checkpoint with %" PetscInt_FMT " vectors written at iteration %" PetscInt_FMT "\n",m,header[1]));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -149,6 +149,8 @@ PetscErrorCode EPSView(EPS eps,PetscViewer viewer)
     if (eps->twosided && eps->problem_type!=EPS_HEP && eps->problem_type!=EPS_GHEP) PetscCall(PetscViewerASCIIPrintf(viewer,"  using two-sided variant (for left eigenvectors)\n"));
     if (eps->purify) PetscCall(PetscViewerASCIIPrintf(viewer,"  postprocessing eigenvectors with purification\n"));
     if (eps->trueres) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing true residuals explicitly\n"));
+    if (eps->recycle) PetscCall(PetscViewerASCIIPrintf(viewer,"  recycling the computed subspace in subsequent solves (%" PetscInt_FMT " extra vectors)\n",eps->nrecextra));
+    if (eps->ckptviewer) PetscCall(PetscViewerASCIIPrintf(viewer,"  writing checkpoints every %" PetscInt_FMT " restarts\n",eps->ckptevery));
     if (eps->trackall) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing all residuals (for tracking convergence)\n"));
     if (eps->stop==EPS_STOP_THRESHOLD) PetscCall(PetscViewerASCIIPrintf(viewer,"  computing eigenvalues %s the threshold: %g%s\n",(eps->which==EPS_SMALLEST_MAGNITUDE||eps->which==EPS_SMALLEST_REAL)?"below":"above",(double)eps->thres,eps->threlative?" (relative)":""));
     if (eps->nev) PetscCall(PetscViewerASCIIPrintf(viewer,"  number of eigenvalues (nev): %" PetscInt_FMT "\n",eps->nev));
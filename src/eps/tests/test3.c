@@ -107,12 +107,32 @@ int main(int argc,char **argv)
       test:
          suffix: 1
          args: -eps_type {{krylovschur subspace arnoldi lapack}}
+      test:
+         suffix: 1_recycle
+         args: -eps_type krylovschur -eps_recycle -eps_recycle_extra 4 -eps_view -info
+         filter: grep -e "recycling the computed" -e "Recycled subspace of dimension" -e "^Tridiagonal" -e "^ - - -" -e "^ All requested" -e "^     [0-9-]" | sed -e "s/^ *recycling/recycling/" -e "s/^.*\(Recycled subspace\) of dimension.*/\1/"
+         output_file: output/test3_1_recycle.out
+      test:
+         suffix: 1_batch
+         args: -eps_type krylovschur -eps_krylovschur_batch_reorthog 5 -eps_view
+         filter: grep -e "batched reorthogonalization" -e "^Tridiagonal" -e "^ - - -" -e "^ All requested" -e "^     [0-9-]" | sed -e "s/^ *local/local/"
+         output_file: output/test3_1_batch.out
       test:
          suffix: 1_lanczos
          args: -eps_type lanczos -eps_lanczos_reorthog local
+      test:
+         suffix: 1_lanczos_twopass
+         args: -eps_type lanczos -eps_lanczos_reorthog local -eps_lanczos_twopass -eps_view
+         filter: grep -e "two-pass" -e "^Tridiagonal" -e "^ - - -" -e "^ All requested" -e "^     [0-9-]" | sed -e "s/^ *using/using/"
+         output_file: output/test3_1_lanczos_twopass.out
       test:
          suffix: 1_power
          args: -eps_type power -eps_max_it 20000
+      test:
+         suffix: 1_power_block
+         args: -eps_type power -eps_power_block_size 4 -eps_max_it 20000 -eps_view
+         filter: grep -e "^ *block size:" -e "^Tridiagonal" -e "^ - - -" -e "^ All requested" -e "^     [0-9-]" | sed -e "s/^ *block/block/"
+         output_file: output/test3_1_power_block.out
       test:
          suffix: 1_jd
          args: -eps_type jd -eps_jd_initial_size 7
@@ -134,6 +154,10 @@ int main(int argc,char **argv)
          suffix: 1_trlan
          args: -eps_type trlan
          requires: trlan
+      test:
+         suffix: 1_lapack_distributed
+         nsize: {{1 2 3}}
+         args: -eps_type lapack -ds_parallel distributed
       test:
          suffix: 1_scalapack
          args: -eps_type scalapack
@@ -153,6 +177,11 @@ int main(int argc,char **argv)
       test:
          suffix: 2_rqcg
          args: -eps_type rqcg -eps_rqcg_reset 5 -eps_ncv 32
+      test:
+         suffix: 2_rqcg_block
+         args: -eps_type rqcg -eps_rqcg_reset 5 -eps_ncv 32 -eps_rqcg_block -eps_view
+         filter: grep -e "block variant with packed" -e "^Tridiagonal" -e "^ - - -" -e "^ All requested" -e "^     [0-9-]" | sed -e "s/^ *using/using/"
+         output_file: output/test3_2_rqcg_block.out
       test:
          suffix: 2_lobpcg
          args: -eps_type lobpcg -eps_lobpcg_blocksize 5 -st_pc_type none
@@ -0,0 +1,126 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests resuming EPSSolve from a checkpoint.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = number of grid subdivisions.\n"
+  "  -file <filename>, name of the checkpoint file (it is removed at the end).\n\n";
+
+#include <slepceps.h>
+
+int main(int argc,char **argv)
+{
+  Mat                A;           /* problem matrix */
+  EPS                eps;         /* eigenproblem solver context */
+  PetscViewer        viewer;
+  EPSConvergedReason reason;
+  char               filename[PETSC_MAX_PATH_LEN] = "test46_ckpt.bin";
+  PetscInt           n=100,i,Istart,Iend,its,its0;
+  PetscMPIInt        rank;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCallMPI(MPI_Comm_rank(PETSC_COMM_WORLD,&rank));
+
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetString(NULL,NULL,"-file",filename,sizeof(filename),NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\n1-D Laplacian Eigenproblem, n=%" PetscInt_FMT "\n\n",n));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>0) PetscCall(MatSetValue(A,i,i-1,-1.0,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(A,i,i+1,-1.0,INSERT_VALUES));
+    PetscCall(MatSetValue(A,i,i,2.0,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         First solve, stopped early, writing checkpoints to the file
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetDimensions(eps,4,12,PETSC_DETERMINE));
+  PetscCall(EPSSetTolerances(eps,PETSC_CURRENT,8));
+  PetscCall(PetscViewerCreate(PETSC_COMM_WORLD,&viewer));
+  PetscCall(PetscViewerSetType(viewer,PETSCVIEWERBINARY));
+  PetscCall(PetscViewerBinarySetSkipInfo(viewer,PETSC_TRUE));
+  PetscCall(PetscViewerFileSetMode(viewer,FILE_MODE_WRITE));
+  PetscCall(PetscViewerFileSetName(viewer,filename));
+  PetscCall(EPSSetCheckpoint(eps,viewer,2));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetConvergedReason(eps,&reason));
+  PetscCall(EPSGetIterationNumber(eps,&its));
+  if (reason==EPS_DIVERGED_ITS) PetscCall(PetscPrintf(PETSC_COMM_WORLD," First solve stopped after %" PetscInt_FMT " iterations\n",its));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD," First solve finished with reason %s\n",EPSConvergedReasons[reason]));
+  PetscCall(EPSDestroy(&eps));   /* closes the checkpoint file */
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         Resume the computation from the last checkpoint in a new EPS
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetDimensions(eps,4,12,PETSC_DETERMINE));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(PetscViewerBinaryOpen(PETSC_COMM_WORLD,filename,FILE_MODE_READ,&viewer));
+  PetscCall(EPSLoadCheckpoint(eps,viewer));
+  PetscCall(PetscViewerDestroy(&viewer));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetIterationNumber(eps,&its));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," Resumed solve from the checkpoint\n"));
+  PetscCall(EPSErrorView(eps,EPS_ERROR_RELATIVE,NULL));
+  PetscCall(EPSDestroy(&eps));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+         Solve from scratch, to check that resuming saved iterations
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(EPSCreate(PETSC_COMM_WORLD,&eps));
+  PetscCall(EPSSetOperators(eps,A,NULL));
+  PetscCall(EPSSetProblemType(eps,EPS_HEP));
+  PetscCall(EPSSetType(eps,EPSKRYLOVSCHUR));
+  PetscCall(EPSSetDimensions(eps,4,12,PETSC_DETERMINE));
+  PetscCall(EPSSetFromOptions(eps));
+  PetscCall(EPSSolve(eps));
+  PetscCall(EPSGetIterationNumber(eps,&its0));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD," Resumed solve needs fewer iterations than a solve from scratch: %s\n",(its<its0)?"yes":"no"));
+  PetscCall(EPSDestroy(&eps));
+
+  /* remove the checkpoint file */
+  PetscCallMPI(MPI_Barrier(PETSC_COMM_WORLD));
+  if (rank==0) PetscCheck(!remove(filename),PETSC_COMM_SELF,PETSC_ERR_FILE_UNEXPECTED,"Unable to remove the checkpoint file %s",filename);
+
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test46_1.out
+      test:
+         suffix: 1
+         args: -file test46_1_ckpt.bin
+      test:
+         suffix: 2
+         nsize: 2
+         args: -file test46_2_ckpt.bin
+
+TEST*/
@@ -126,6 +126,9 @@ int main(int argc,char **argv)
          suffix: 2
          requires: defined(PETSC_HAVE_DYNAMIC_LIBRARIES) defined(PETSC_USE_SHARED_LIBRARIES)
          args: -library_preload
+      test:
+         suffix: 1_chebyshev
+         args: -eps_type subspace -eps_subspace_chebyshev -eps_largest_real
 
    testset:
       args: -n 30 -eps_type ciss -eps_ciss_realmats -terse
@@ -14,12 +14,18 @@
 
    Algorithm:
 
-       Simple residual inverse iteration with varying shift.
+       Simple residual inverse iteration with varying shift. For Hermitian
+       problems in split form, a block variant iterates several Rayleigh
+       functional pairs simultaneously, with a LOBPCG-like search space.
 
    References:
 
        [1] A. Neumaier, "Residual inverse iteration for the nonlinear
            eigenvalue problem", SIAM J. Numer. Anal. 22(5):914-923, 1985.
+
+       [2] D.B. Szyld and F. Xue, "Preconditioned eigensolvers for large-scale
+           nonlinear Hermitian eigenproblems with variational characterizations.
+           II. Interior eigenvalues", SIAM J. Sci. Comput. 37(6):A2969-A2997, 2015.
 */
 
 #include <slepc/private/nepimpl.h>         /*I "slepcnep.h" I*/
@@ -31,19 +37,33 @@ typedef struct {
   PetscBool cctol;            /* constant correction tolerance */
   PetscBool herm;             /* whether the Hermitian version of the scalar equation must be used */
   PetscReal deftol;           /* tolerance for the deflation (threshold) */
+  PetscBool block;            /* whether the block variant must be used */
   KSP       ksp;              /* linear solver object */
 } NEP_RII;
 
+static PetscErrorCode NEPSolve_RII(NEP);
+static PetscErrorCode NEPSolve_RII_Block(NEP);
+
 static PetscErrorCode NEPSetUp_RII(NEP nep)
 {
+  NEP_RII *ctx = (NEP_RII*)nep->data;
+
   PetscFunctionBegin;
   if (nep->ncv!=PETSC_DETERMINE) PetscCall(PetscInfo(nep,"Setting ncv = nev, ignoring user-provided value\n"));
   nep->ncv = nep->nev;
   if (nep->mpd!=PETSC_DETERMINE) PetscCall(PetscInfo(nep,"Setting mpd = nev, ignoring user-provided value\n"));
   nep->mpd = nep->nev;
   if (nep->max_it==PETSC_DETERMINE) nep->max_it = PetscMax(5000,2*nep->n/nep->ncv);
-  if (!nep->which) nep->which = NEP_TARGET_MAGNITUDE;
-  PetscCheck(nep->which==NEP_TARGET_MAGNITUDE,PetscObjectComm((PetscObject)nep),PETSC_ERR_SUP,"This solver supports only target magnitude eigenvalues");
+  if (ctx->block) {
+    PetscCheck(nep->fui==NEP_USER_INTERFACE_SPLIT,PetscObjectComm((PetscObject)nep),PETSC_ERR_SUP,"The block variant of RII requires the problem in split form");
+    if (!nep->which) nep->which = NEP_SMALLEST_REAL;
+    PetscCheck(nep->which==NEP_SMALLEST_REAL || nep->which==NEP_LARGEST_REAL,PetscObjectComm((PetscObject)nep),PETSC_ERR_SUP,"The block variant of RII supports only smallest or largest real eigenvalues");
+    nep->ops->solve = NEPSolve_RII_Block;
+  } else {
+    if (!nep->which) nep->which = NEP_TARGET_MAGNITUDE;
+    PetscCheck(nep->which==NEP_TARGET_MAGNITUDE,PetscObjectComm((PetscObject)nep),PETSC_ERR_SUP,"This solver supports only target magnitude eigenvalues");
+    nep->ops->solve = NEPSolve_RII;
+  }
   NEPCheckUnsupported(nep,NEP_FEATURE_REGION | NEP_FEATURE_TWOSIDED);
   PetscCall(NEPAllocateSolution(nep,0));
   PetscCall(NEPSetWorkVecs(nep,2));
@@ -203,10 +223,235 @@ static PetscErrorCode NEPSolve_RII(NEP nep)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Rayleigh-Ritz step of the block variant: for each of the first k wanted
+   eigenvalues, run the safeguarded iteration on the projected problem
+   sum_i f_i(lambda)*G_i, where G_i = S'*A_i*S. The j-th eigenvector of the
+   projected T(lambda) in the minmax order is taken, and lambda is updated
+   with the projected Rayleigh functional (Newton on y'*T(lambda)*y=0).
+*/
+static PetscErrorCode NEPRIIBlockRayleighRitz(NEP nep,Mat *G,PetscInt m,PetscInt k,PetscReal s,PetscScalar *eig,Mat Y)
+{
+  NEP_RII           *ctx = (NEP_RII*)nep->data;
+  PetscInt          i,j,r,c,it,inner,ld,ldg,idx,*perm;
+  PetscScalar       *pA,*pY,*wr,*pX,fv,dfv,lambda,lnew,t;
+  const PetscScalar *pG;
+  PetscReal         *re,*g,phi,dphi,corr;
+
+  PetscFunctionBegin;
+  PetscCall(DSGetLeadingDimension(nep->ds,&ld));
+  PetscCall(MatDenseGetLDA(Y,&ldg));
+  PetscCall(PetscMalloc4(m,&wr,m,&re,m,&perm,nep->nt,&g));
+  PetscCall(MatZeroEntries(Y));
+  PetscCall(MatDenseGetArray(Y,&pY));
+  for (j=0;j<k;j++) {
+    lambda = eig[j];
+    for (it=0;it<ctx->max_inner_it;it++) {
+      /* eigenvector of the projected T(lambda) associated with the j-th eigenvalue in the minmax order */
+      PetscCall(DSSetDimensions(nep->ds,m,0,0));
+      PetscCall(DSGetArray(nep->ds,DS_MAT_A,&pA));
+      for (c=0;c<m;c++) for (r=0;r<m;r++) pA[r+c*ld] = 0.0;
+      for (i=0;i<nep->nt;i++) {
+        PetscCall(FNEvaluateFunction(nep->f[i],lambda,&fv));
+        PetscCall(MatDenseGetArrayRead(G[i],&pG));
+        for (c=0;c<m;c++) for (r=0;r<m;r++) pA[r+c*ld] += s*fv*pG[r+c*ldg];
+        PetscCall(MatDenseRestoreArrayRead(G[i],&pG));
+      }
+      PetscCall(DSRestoreArray(nep->ds,DS_MAT_A,&pA));
+      PetscCall(DSSetState(nep->ds,DS_STATE_RAW));
+      PetscCall(DSSolve(nep->ds,wr,NULL));
+      PetscCall(DSSynchronize(nep->ds,wr,NULL));
+      for (r=0;r<m;r++) {
+        re[r]   = PetscRealPart(wr[r]);
+        perm[r] = r;
+      }
+      PetscCall(PetscSortRealWithPermutation(m,re,perm));
+      idx = (nep->which==NEP_LARGEST_REAL)? perm[j]: perm[m-1-j];
+      PetscCall(DSVectors(nep->ds,DS_MAT_X,NULL,NULL));
+      PetscCall(DSGetArray(nep->ds,DS_MAT_X,&pX));
+      for (r=0;r<m;r++) pY[r+j*ldg] = pX[r+idx*ld];
+      PetscCall(DSRestoreArray(nep->ds,DS_MAT_X,&pX));
+
+      /* Newton iteration for the Rayleigh functional, with the scalars y'*G_i*y computed once */
+      for (i=0;i<nep->nt;i++) {
+        PetscCall(MatDenseGetArrayRead(G[i],&pG));
+        t = 0.0;
+        for (c=0;c<m;c++) for (r=0;r<m;r++) t += PetscConj(pY[r+j*ldg])*pG[r+c*ldg]*pY[c+j*ldg];
+        g[i] = PetscRealPart(t);
+        PetscCall(MatDenseRestoreArrayRead(G[i],&pG));
+      }
+      lnew = lambda;
+      for (inner=0;inner<ctx->max_inner_it;inner++) {
+        phi = dphi = 0.0;
+        for (i=0;i<nep->nt;i++) {
+          PetscCall(FNEvaluateFunction(nep->f[i],lnew,&fv));
+          PetscCall(FNEvaluateDerivative(nep->f[i],lnew,&dfv));
+          phi  += PetscRealPart(fv)*g[i];
+          dphi += PetscRealPart(dfv)*g[i];
+        }
+        if (dphi==0.0) break;
+        corr = phi/dphi;
+        lnew -= corr;
+        if (PetscAbsReal(corr)<=PETSC_SQRT_MACHINE_EPSILON*PetscAbsScalar(lnew)) break;
+      }
+      t = lnew-lambda;
+      lambda = lnew;
+      if (PetscAbsScalar(t)<=PETSC_SQRT_MACHINE_EPSILON*PetscAbsScalar(lambda)) break;
+    }
+    eig[j] = lambda;
+  }
+  PetscCall(MatDenseRestoreArray(Y,&pY));
+  PetscCall(PetscFree4(wr,re,perm,g));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode NEPSolve_RII_Block(NEP nep)
+{
+  NEP_RII            *ctx = (NEP_RII*)nep->data;
+  BV                 S,W,P,R;
+  Mat                *G,Y,B,MR,MW;
+  Vec                x,r,z;
+  PetscScalar        sigma,dfv,*pA;
+  const PetscScalar  *pG;
+  PetscReal          s=1.0,t,nrm;
+  PetscInt           i,j,k=nep->ncv,m=nep->ncv,nw,ld,ldg;
+  PetscBool          hasp=PETSC_FALSE;
+  KSPConvergedReason kspreason;
+
+  PetscFunctionBegin;
+  if (!ctx->ksp) PetscCall(NEPRIIGetKSP(nep,&ctx->ksp));
+
+  /* the search space [X W P] has at most 3*k columns */
+  PetscCall(BVDuplicateResize(nep->V,3*k,&S));
+  PetscCall(BVDuplicateResize(nep->V,k,&W));
+  PetscCall(BVDuplicateResize(nep->V,k,&P));
+  PetscCall(BVDuplicateResize(nep->V,k,&R));
+  PetscCall(PetscMalloc1(nep->nt,&G));
+  for (i=0;i<nep->nt;i++) PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,3*k,3*k,NULL,&G[i]));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,3*k,k,NULL,&Y));
+  PetscCall(MatDenseGetLDA(G[0],&ldg));
+  PetscCall(DSSetType(nep->ds,DSHEP));
+  PetscCall(DSAllocate(nep->ds,3*k));
+
+  /* initial block and preconditioner, which is computed only once at sigma */
+  sigma = nep->target;
+  for (j=nep->nini;j<k;j++) PetscCall(BVSetRandomColumn(nep->V,j));
+  for (j=0;j<k;j++) nep->eigr[j] = sigma;
+  B = nep->function_pre? nep->function_pre: nep->function;
+  PetscCall(NEPComputeFunction(nep,sigma,nep->function,B));
+  PetscCall(NEP_KSPSetOperators(ctx->ksp,nep->function,B));
+  PetscCall(KSPSetUp(ctx->ksp));
+  PetscCall(BVSetActiveColumns(nep->V,0,k));
+  PetscCall(BVSetActiveColumns(S,0,k));
+  PetscCall(BVCopy(nep->V,S));
+
+  while (nep->reason == NEP_CONVERGED_ITERATING) {
+    nep->its++;
+
+    /* orthonormalize the search space and project the split matrices */
+    PetscCall(BVSetActiveColumns(S,0,m));
+    for (j=0;j<m;j++) PetscCall(BVOrthonormalizeColumn(S,j,PETSC_TRUE,NULL,NULL));
+    for (i=0;i<nep->nt;i++) PetscCall(BVMatProject(S,nep->A[i],S,G[i]));
+    if (nep->its==1) {
+      /* orientation of the problem, so that y'*T(lambda)*y is increasing in lambda */
+      t = 0.0;
+      for (i=0;i<nep->nt;i++) {
+        PetscCall(FNEvaluateDerivative(nep->f[i],sigma,&dfv));
+        PetscCall(MatDenseGetArrayRead(G[i],&pG));
+        for (j=0;j<k;j++) t += PetscRealPart(dfv*pG[j+j*ldg]);
+        PetscCall(MatDenseRestoreArrayRead(G[i],&pG));
+      }
+      if (t<0.0) s = -1.0;
+    }
+
+    /* nonlinear Rayleigh-Ritz on the search space */
+    PetscCall(NEPRIIBlockRayleighRitz(nep,G,m,k,s,nep->eigr,Y));
+
+    /* update the directions P = S(:,k:m)*Y(k:m,:) and the block X = S*Y */
+    if (m>k) {
+      PetscCall(BVSetActiveColumns(S,k,m));
+      PetscCall(BVSetActiveColumns(P,nep->nconv,k));
+      PetscCall(BVMult(P,1.0,0.0,S,Y));
+      hasp = PETSC_TRUE;
+    }
+    PetscCall(BVSetActiveColumns(S,0,m));
+    PetscCall(BVMult(nep->V,1.0,0.0,S,Y));
+
+    /* residuals of the unconverged pairs, r_j = T(lambda_j)*x_j */
+    for (j=nep->nconv;j<k;j++) {
+      PetscCall(BVGetColumn(nep->V,j,&x));
+      PetscCall(BVGetColumn(R,j,&r));
+      PetscCall(NEPApplyFunction(nep,nep->eigr[j],x,nep->work[0],r,NULL,NULL));
+      PetscCall(VecNorm(r,NORM_2,&nrm));
+      PetscCall((*nep->converged)(nep,nep->eigr[j],0,nrm,&nep->errest[j],nep->convergedctx));
+      PetscCall(BVRestoreColumn(R,j,&r));
+      PetscCall(BVRestoreColumn(nep->V,j,&x));
+    }
+    for (j=nep->nconv;j<k && nep->errest[j]<=nep->tol;j++);
+    nep->nconv = j;
+    PetscCall((*nep->stopping)(nep,nep->its,nep->max_it,nep->nconv,nep->nev,&nep->reason,nep->stoppingctx));
+    PetscCall(NEPMonitor(nep,nep->its,nep->nconv,nep->eigr,nep->eigi,nep->errest,k));
+    if (nep->reason != NEP_CONVERGED_ITERATING) break;
+
+    /* preconditioned residuals of the active block, W = T(sigma)\R */
+    PetscCall(BVSetActiveColumns(R,nep->nconv,k));
+    PetscCall(BVSetActiveColumns(W,nep->nconv,k));
+    PetscCall(BVGetMat(R,&MR));
+    PetscCall(BVGetMat(W,&MW));
+    PetscCall(KSPMatSolve(ctx->ksp,MR,MW));
+    PetscCall(BVRestoreMat(W,&MW));
+    PetscCall(BVRestoreMat(R,&MR));
+    PetscCall(KSPGetConvergedReason(ctx->ksp,&kspreason));
+    if (kspreason<0) {
+      PetscCall(PetscInfo(nep,"iter=%" PetscInt_FMT ", linear solve failed, stopping solve\n",nep->its));
+      nep->reason = NEP_DIVERGED_LINEAR_SOLVE;
+      break;
+    }
+
+    /* new search space [X W P], soft-locked columns contribute only to X */
+    nw = k-nep->nconv;
+    PetscCall(BVSetActiveColumns(S,0,k));
+    PetscCall(BVCopy(nep->V,S));
+    for (j=0;j<nw;j++) {
+      PetscCall(BVGetColumn(S,k+j,&z));
+      PetscCall(BVCopyVec(W,nep->nconv+j,z));
+      PetscCall(BVRestoreColumn(S,k+j,&z));
+      if (hasp) {
+        PetscCall(BVGetColumn(S,k+nw+j,&z));
+        PetscCall(BVCopyVec(P,nep->nconv+j,z));
+        PetscCall(BVRestoreColumn(S,k+nw+j,&z));
+      }
+    }
+    m = hasp? k+2*nw: k+nw;
+  }
+
+  /* the block X holds the eigenvectors, set a diagonal projected matrix */
+  PetscCall(DSSetType(nep->ds,DSNHEP));
+  PetscCall(DSAllocate(nep->ds,PetscMax(nep->nconv,1)));
+  PetscCall(DSSetDimensions(nep->ds,nep->nconv,0,nep->nconv));
+  PetscCall(DSGetLeadingDimension(nep->ds,&ld));
+  PetscCall(DSGetArray(nep->ds,DS_MAT_A,&pA));
+  for (j=0;j<nep->nconv;j++) {
+    for (i=0;i<nep->nconv;i++) pA[i+j*ld] = 0.0;
+    pA[j+j*ld] = nep->eigr[j];
+  }
+  PetscCall(DSRestoreArray(nep->ds,DS_MAT_A,&pA));
+  PetscCall(DSSolve(nep->ds,nep->eigr,nep->eigi));
+
+  for (i=0;i<nep->nt;i++) PetscCall(MatDestroy(&G[i]));
+  PetscCall(PetscFree(G));
+  PetscCall(MatDestroy(&Y));
+  PetscCall(BVDestroy(&S));
+  PetscCall(BVDestroy(&W));
+  PetscCall(BVDestroy(&P));
+  PetscCall(BVDestroy(&R));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode NEPSetFromOptions_RII(NEP nep,PetscOptionItems *PetscOptionsObject)
 {
   NEP_RII        *ctx = (NEP_RII*)nep->data;
-  PetscBool      flg;
+  PetscBool      flg,b;
   PetscInt       i;
   PetscReal      r;
 
@@ -229,6 +474,9 @@ static PetscErrorCode NEPSetFromOptions_RII(NEP nep,PetscOptionItems *PetscOptio
     PetscCall(PetscOptionsReal("-nep_rii_deflation_threshold","Tolerance used as a threshold for including deflated eigenpairs","NEPRIISetDeflationThreshold",ctx->deftol,&r,&flg));
     if (flg) PetscCall(NEPRIISetDeflationThreshold(nep,r));
 
+    PetscCall(PetscOptionsBool("-nep_rii_block_iteration","Use the block variant for Hermitian problems","NEPRIISetBlockIteration",ctx->block,&b,&flg));
+    if (flg) PetscCall(NEPRIISetBlockIteration(nep,b));
+
   PetscOptionsHeadEnd();
 
   if (!ctx->ksp) PetscCall(NEPRIIGetKSP(nep,&ctx->ksp));
@@ -606,6 +854,93 @@ PetscErrorCode NEPRIIGetDeflationThreshold(NEP nep,PetscReal *deftol)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode NEPRIISetBlockIteration_RII(NEP nep,PetscBool block)
+{
+  NEP_RII *ctx = (NEP_RII*)nep->data;
+
+  PetscFunctionBegin;
+  if (ctx->block != block) {
+    ctx->block = block;
+    nep->state = NEP_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPRIISetBlockIteration - Sets a flag to indicate that the block variant
+   of the solver must be used.
+
+   Logically Collective
+
+   Input Parameters:
++  nep   - nonlinear eigenvalue solver
+-  block - a boolean value
+
+   Options Database Keys:
+.  -nep_rii_block_iteration <bool> - set the boolean flag
+
+   Notes:
+   The block variant is intended for Hermitian problems whose eigenvalues
+   satisfy a minmax characterization. Instead of computing one eigenpair at
+   a time with deflation, it iterates simultaneously nev approximations,
+   whose eigenvalues are given by the Rayleigh functional. At each step, the
+   search space is formed by the current block, the preconditioned residuals
+   and the previous search directions, as in LOBPCG, and the safeguarded
+   iteration is applied to the projected nonlinear problem.
+
+   The problem must be provided in split form, see NEPSetSplitOperator().
+   Only the smallest or largest real eigenvalues can be computed, see
+   NEPSetWhichEigenpairs(). The target is used as the initial guess for the
+   eigenvalues, and the linear solver is set up only once at the target, so
+   the lag and correction tolerance settings have no effect in this case.
+
+   Level: advanced
+
+.seealso: NEPRIIGetBlockIteration(), NEPRIISetHermitian()
+@*/
+PetscErrorCode NEPRIISetBlockIteration(NEP nep,PetscBool block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscValidLogicalCollectiveBool(nep,block,2);
+  PetscTryMethod(nep,"NEPRIISetBlockIteration_C",(NEP,PetscBool),(nep,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode NEPRIIGetBlockIteration_RII(NEP nep,PetscBool *block)
+{
+  NEP_RII *ctx = (NEP_RII*)nep->data;
+
+  PetscFunctionBegin;
+  *block = ctx->block;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   NEPRIIGetBlockIteration - Returns the flag indicating whether the block
+   variant of the solver is used.
+
+   Not Collective
+
+   Input Parameter:
+.  nep - nonlinear eigenvalue solver
+
+   Output Parameter:
+.  block - the value of the block flag
+
+   Level: advanced
+
+.seealso: NEPRIISetBlockIteration()
+@*/
+PetscErrorCode NEPRIIGetBlockIteration(NEP nep,PetscBool *block)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(nep,NEP_CLASSID,1);
+  PetscAssertPointer(block,2);
+  PetscUseMethod(nep,"NEPRIIGetBlockIteration_C",(NEP,PetscBool*),(nep,block));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode NEPRIISetKSP_RII(NEP nep,KSP ksp)
 {
   NEP_RII        *ctx = (NEP_RII*)nep->data;
@@ -698,6 +1033,7 @@ static PetscErrorCode NEPView_RII(NEP nep,PetscViewer viewer)
     if (ctx->herm) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the Hermitian version of the scalar nonlinear equation\n"));
     if (ctx->lag) PetscCall(PetscViewerASCIIPrintf(viewer,"  updating the preconditioner every %" PetscInt_FMT " iterations\n",ctx->lag));
     if (ctx->deftol) PetscCall(PetscViewerASCIIPrintf(viewer,"  deflation threshold: %g\n",(double)ctx->deftol));
+    if (ctx->block) PetscCall(PetscViewerASCIIPrintf(viewer,"  using the block variant with Rayleigh functional updates\n"));
     if (!ctx->ksp) PetscCall(NEPRIIGetKSP(nep,&ctx->ksp));
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(KSPView(ctx->ksp,viewer));
@@ -732,6 +1068,8 @@ static PetscErrorCode NEPDestroy_RII(NEP nep)
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetHermitian_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetDeflationThreshold_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetDeflationThreshold_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetBlockIteration_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetBlockIteration_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetKSP_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetKSP_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -749,6 +1087,7 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_RII(NEP nep)
   ctx->cctol        = PETSC_FALSE;
   ctx->herm         = PETSC_FALSE;
   ctx->deftol       = 0.0;
+  ctx->block        = PETSC_FALSE;
 
   nep->useds = PETSC_TRUE;
 
@@ -770,6 +1109,8 @@ SLEPC_EXTERN PetscErrorCode NEPCreate_RII(NEP nep)
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetHermitian_C",NEPRIIGetHermitian_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetDeflationThreshold_C",NEPRIISetDeflationThreshold_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetDeflationThreshold_C",NEPRIIGetDeflationThreshold_RII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetBlockIteration_C",NEPRIISetBlockIteration_RII));
+  PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetBlockIteration_C",NEPRIIGetBlockIteration_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIISetKSP_C",NEPRIISetKSP_RII));
   PetscCall(PetscObjectComposeFunction((PetscObject)nep,"NEPRIIGetKSP_C",NEPRIIGetKSP_RII));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -216,6 +216,9 @@ int main(int argc,char **argv)
       test:
          suffix: 8
          args: -nep_type {{rii slp narnoldi}}
+      test:
+         suffix: 8_rii_block
+         args: -nep_type rii -nep_rii_block_iteration -nep_rii_ksp_type preonly -nep_rii_pc_type lu
       test:
          suffix: 8_rii_thres
          args: -nep_type rii -nep_rii_deflation_threshold 5e-10
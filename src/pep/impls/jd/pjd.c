@@ -67,6 +67,7 @@ typedef struct {
   Vec         vtempl;        /* reference nested vector */
   PetscInt    midx;          /* minimality index */
   PetscInt    mmidx;         /* maximum allowed minimality index */
+  PetscInt    bs;            /* block size (number of correction equations per iteration) */
   PEPJDProjection proj;      /* projection type (orthogonal, harmonic) */
 } PEP_JD;
 
@@ -1164,7 +1165,10 @@ static PetscErrorCode PEPJDLockConverged(PEP pep,PetscInt *nv,PetscInt sz)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode PEPJDSystemSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Vec *u,Vec *p,Vec *ww)
+/*
+   Update the projectors of the correction equation for the Ritz vector u
+*/
+static PetscErrorCode PEPJDProjectorSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Vec *u,Vec *p,Vec *ww)
 {
   PEP_JD         *pjd = (PEP_JD*)pep->data;
   PEP_JD_PCSHELL *pcctx;
@@ -1174,7 +1178,6 @@ static PetscErrorCode PEPJDSystemSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Ve
 
   PetscFunctionBegin;
   PetscCall(PCShellGetContext(pjd->pcshell,&pcctx));
-  PetscCall(PEPJDMatSetUp(pep,sz,theta));
   pcctx->u[0] = u[0]; pcctx->u[1] = u[1];
   /* Compute r'. p is a work space vector */
   PetscCall(PEPJDComputeResidual(pep,PETSC_TRUE,sz,u,theta,p,ww));
@@ -1196,6 +1199,85 @@ static PetscErrorCode PEPJDSystemSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Ve
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PEPJDSystemSetUp(PEP pep,PetscInt sz,PetscScalar *theta,Vec *u,Vec *p,Vec *ww)
+{
+  PetscFunctionBegin;
+  PetscCall(PEPJDMatSetUp(pep,sz,theta));
+  PetscCall(PEPJDProjectorSetUp(pep,sz,theta,u,p,ww));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Block variant: expand the search space with the corrections associated with
+   the Ritz pairs that follow the leading one (starting at index j of the
+   projected problem of size nvp). All correction equations share the operator
+   P(theta) and its preconditioner, which have already been set up
+*/
+static PetscErrorCode PEPJDBlockExpand(PEP pep,PetscInt j,PetscInt nvp,PetscInt *nv,PetscScalar *theta,Vec *u,Vec *p,Vec *r,Vec *ww)
+{
+  PEP_JD         *pjd = (PEP_JD*)pep->data;
+  PetscInt       nb=1,ld,nloc,kspsf=1;
+  PetscMPIInt    np,count;
+  PetscScalar    ritz[2]={0.0,0.0},*pX,*array;
+  PetscReal      norm,normw;
+  PetscBool      lindep;
+  Vec            t[2]={NULL,NULL},rr[2]={NULL,NULL},tc,rc;
+  KSP            ksp;
+
+  PetscFunctionBegin;
+  PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)pep),&np));
+  PetscCall(BVGetSizes(pep->V,&nloc,NULL,NULL));
+  PetscCall(DSGetLeadingDimension(pep->ds,&ld));
+  PetscCall(STGetKSP(pep->st,&ksp));
+  PetscCall(PetscMPIIntCast(pep->nconv,&count));
+#if !defined (PETSC_USE_COMPLEX)
+  kspsf = 2;
+#endif
+  while (nb<pjd->bs && j<nvp && *nv<pep->ncv-2) {
+#if !defined(PETSC_USE_COMPLEX)
+    if (pep->eigi[j]!=0.0) {  /* complex conjugate pairs are not included in the block */
+      j += 2;
+      continue;
+    }
+#endif
+    ritz[0] = pep->eigr[j];
+    /* Compute Ritz vector u=V*X(:,j) and its residual */
+    PetscCall(DSGetArray(pep->ds,DS_MAT_X,&pX));
+    PetscCall(BVSetActiveColumns(pjd->V,0,nvp));
+    PetscCall(BVMultVec(pjd->V,1.0,0.0,u[0],pX+j*ld));
+    PetscCall(DSRestoreArray(pep->ds,DS_MAT_X,&pX));
+    PetscCall(PEPJDComputeResidual(pep,PETSC_FALSE,1,u,ritz,r,ww));
+    j++;
+    /* Update the projectors, the matrix and the preconditioner are reused */
+    PetscCall(PEPJDProjectorSetUp(pep,1,theta,u,p,ww));
+    PetscCall(BVGetColumn(pjd->V,*nv,&t[0]));
+    rr[0] = r[0];
+    PetscCall(VecCreateCompWithVecs(t,kspsf,pjd->vtempl,&tc));
+    PetscCall(VecCreateCompWithVecs(rr,kspsf,pjd->vtempl,&rc));
+    PetscCall(VecCompSetSubVecs(pjd->vtempl,1,NULL));
+    PetscCall(KSPSolve(ksp,rc,tc));
+    PetscCall(VecDestroy(&tc));
+    PetscCall(VecDestroy(&rc));
+    PetscCall(VecGetArray(t[0],&array));
+    PetscCallMPI(MPI_Bcast(array+nloc,count,MPIU_SCALAR,np-1,PetscObjectComm((PetscObject)pep)));
+    PetscCall(VecRestoreArray(t[0],&array));
+    PetscCall(BVRestoreColumn(pjd->V,*nv,&t[0]));
+    PetscCall(BVOrthogonalizeColumn(pjd->V,*nv,NULL,&norm,&lindep));
+    if (lindep || norm==0.0) continue;  /* discard the correction */
+    if (pjd->proj==PEP_JD_PROJECTION_HARMONIC) {
+      PetscCall(BVInsertVec(pjd->W,*nv,r[0]));
+      PetscCall(BVOrthogonalizeColumn(pjd->W,*nv,NULL,&normw,&lindep));
+      if (lindep || normw==0.0) continue;
+      PetscCall(BVScaleColumn(pjd->W,*nv,1.0/normw));
+    }
+    PetscCall(BVScaleColumn(pjd->V,*nv,1.0/norm));
+    (*nv)++;
+    nb++;
+  }
+  PetscCall(BVSetActiveColumns(pjd->V,0,*nv));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PEPSolve_JD(PEP pep)
 {
   PEP_JD          *pjd = (PEP_JD*)pep->data;
@@ -1421,6 +1503,8 @@ static PetscErrorCode PEPSolve_JD(PEP pep)
         }
         bupdated = idx?0:nv;
         nv += sz-off;
+        /* Block variant: add corrections for the next Ritz pairs */
+        if (pjd->bs>1 && !idx && theta[1]==0.0) PetscCall(PEPJDBlockExpand(pep,sz,nvc,&nv,theta,u,p,r,ww));
       }
       for (k=0;k<nvc;k++) {
         eig[pep->nconv-idx+k] = pep->eigr[k];
@@ -1853,6 +1937,89 @@ PetscErrorCode PEPJDGetProjection(PEP pep,PEPJDProjection *proj)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PEPJDSetBlockSize_JD(PEP pep,PetscInt bs)
+{
+  PEP_JD *pjd = (PEP_JD*)pep->data;
+
+  PetscFunctionBegin;
+  if (bs == PETSC_DEFAULT || bs == PETSC_DECIDE) bs = 1;
+  PetscCheck(bs>0,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_OUTOFRANGE,"Invalid block size value, should be >0");
+  pjd->bs = bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPJDSetBlockSize - Sets the number of correction equations solved in each
+   iteration of the Jacobi-Davidson solver.
+
+   Logically Collective
+
+   Input Parameters:
++  pep - the eigenproblem solver context
+-  bs  - the block size
+
+   Options Database Key:
+.  -pep_jd_blocksize - the block size
+
+   Notes:
+   With a block size b>1, in each iteration the search space is expanded with
+   the solution of the correction equations associated with the leading b Ritz
+   pairs of the projected problem, instead of only the first one. All correction
+   equations share the same coefficient matrix P(theta) and preconditioner, which
+   are set up only once per iteration, so the cost of building the preconditioner
+   is amortized over the block.
+
+   The block is formed only in iterations where no Ritz pair has converged and
+   the shift theta is real. In real arithmetic, complex conjugate Ritz pairs other
+   than the leading one are skipped.
+
+   Level: advanced
+
+.seealso: PEPJDGetBlockSize()
+@*/
+PetscErrorCode PEPJDSetBlockSize(PEP pep,PetscInt bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscValidLogicalCollectiveInt(pep,bs,2);
+  PetscTryMethod(pep,"PEPJDSetBlockSize_C",(PEP,PetscInt),(pep,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PEPJDGetBlockSize_JD(PEP pep,PetscInt *bs)
+{
+  PEP_JD *pjd = (PEP_JD*)pep->data;
+
+  PetscFunctionBegin;
+  *bs = pjd->bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPJDGetBlockSize - Returns the number of correction equations solved in each
+   iteration of the Jacobi-Davidson solver.
+
+   Not Collective
+
+   Input Parameter:
+.  pep - the eigenproblem solver context
+
+   Output Parameter:
+.  bs - the block size
+
+   Level: advanced
+
+.seealso: PEPJDSetBlockSize()
+@*/
+PetscErrorCode PEPJDGetBlockSize(PEP pep,PetscInt *bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscAssertPointer(bs,2);
+  PetscUseMethod(pep,"PEPJDGetBlockSize_C",(PEP,PetscInt*),(pep,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PEPSetFromOptions_JD(PEP pep,PetscOptionItems *PetscOptionsObject)
 {
   PetscBool       flg,b1;
@@ -1878,6 +2045,9 @@ static PetscErrorCode PEPSetFromOptions_JD(PEP pep,PetscOptionItems *PetscOption
     PetscCall(PetscOptionsEnum("-pep_jd_projection","Type of projection","PEPJDSetProjection",PEPJDProjectionTypes,(PetscEnum)PEP_JD_PROJECTION_HARMONIC,(PetscEnum*)&proj,&flg));
     if (flg) PetscCall(PEPJDSetProjection(pep,proj));
 
+    PetscCall(PetscOptionsInt("-pep_jd_blocksize","Number of correction equations per iteration","PEPJDSetBlockSize",1,&i1,&flg));
+    if (flg) PetscCall(PEPJDSetBlockSize(pep,i1));
+
   PetscOptionsHeadEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1895,6 +2065,7 @@ static PetscErrorCode PEPView_JD(PEP pep,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer,"  projection type: %s\n",PEPJDProjectionTypes[pjd->proj]));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  maximum allowed minimality index: %" PetscInt_FMT "\n",pjd->mmidx));
     if (pjd->reusepc) PetscCall(PetscViewerASCIIPrintf(viewer,"  reusing the preconditioner\n"));
+    if (pjd->bs>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  block size: %" PetscInt_FMT "\n",pjd->bs));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1950,6 +2121,8 @@ static PetscErrorCode PEPDestroy_JD(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetMinimalityIndex_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetProjection_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetProjection_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetBlockSize_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1964,6 +2137,7 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_JD(PEP pep)
   pep->lineariz = PETSC_FALSE;
   pjd->fix      = 0.01;
   pjd->mmidx    = 0;
+  pjd->bs       = 1;
 
   pep->ops->solve          = PEPSolve_JD;
   pep->ops->setup          = PEPSetUp_JD;
@@ -1983,5 +2157,7 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_JD(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetMinimalityIndex_C",PEPJDGetMinimalityIndex_JD));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetProjection_C",PEPJDSetProjection_JD));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetProjection_C",PEPJDGetProjection_JD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDSetBlockSize_C",PEPJDSetBlockSize_JD));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPJDGetBlockSize_C",PEPJDGetBlockSize_JD));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
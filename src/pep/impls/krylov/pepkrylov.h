@@ -19,6 +19,7 @@ SLEPC_INTERN PetscErrorCode PEPSolve_STOAR(PEP);
 SLEPC_INTERN PetscErrorCode PEPSolve_STOAR_QSlice(PEP);
 SLEPC_INTERN PetscErrorCode PEPSetUp_STOAR_QSlice(PEP);
 SLEPC_INTERN PetscErrorCode PEPReset_STOAR_QSlice(PEP);
+SLEPC_INTERN PetscErrorCode PEPDestroy_STOAR_QSlice(PEP);
 
 typedef struct {
   PetscReal     keep;         /* restart parameter */
@@ -101,4 +102,13 @@ typedef struct {
   PetscBool     hyperbolic;     /* hyperbolic problem flag */
   PetscReal     alpha,beta;     /* coefficients defining the linearization */
   PetscBool     checket;        /* check eigenvalue type during spectrum slicing */
+  /* the following are used only in multi-communicator spectrum slicing */
+  PetscInt      npart;          /* number of partitions of subcommunicator */
+  PetscReal     *subintervals;  /* partition of global interval */
+  PetscBool     subintset;      /* subintervals set by user */
+  PetscMPIInt   *nconv_loc;     /* converged eigenpairs for each subinterval */
+  PEP           pep;            /* additional pep for subinterval runs */
+  PetscSubcomm  subc;           /* context for subcommunicators */
+  MPI_Comm      commrank;       /* group processes with same rank in subcommunicators */
+  PetscBool     commset;        /* flag indicating that commrank was created */
 } PEP_STOAR;
@@ -61,7 +61,9 @@ static PetscErrorCode PEPQSliceResetSR(PEP pep)
       PetscCall(PetscFree(s));
     }
     PetscCall(PetscFree(sr->S));
-    for (i=0;i<pep->nconv;i++) PetscCall(PetscFree(sr->qinfo[i].q));
+    if (sr->qinfo) {
+      for (i=0;i<pep->nconv;i++) PetscCall(PetscFree(sr->qinfo[i].q));
+    }
     PetscCall(PetscFree(sr->qinfo));
     for (i=0;i<3;i++) PetscCall(VecDestroy(&sr->v[i]));
     PetscCall(EPSDestroy(&sr->eps));
@@ -79,6 +81,26 @@ PetscErrorCode PEPReset_STOAR_QSlice(PEP pep)
   PetscCall(PEPQSliceResetSR(pep));
   PetscCall(PetscFree(ctx->inertias));
   PetscCall(PetscFree(ctx->shifts));
+  if (ctx->npart>1) {
+    if (ctx->pep) PetscCall(PEPReset(ctx->pep));
+    PetscCall(PetscFree(ctx->nconv_loc));
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+PetscErrorCode PEPDestroy_STOAR_QSlice(PEP pep)
+{
+  PEP_STOAR      *ctx=(PEP_STOAR*)pep->data;
+
+  PetscFunctionBegin;
+  PetscCall(PEPDestroy(&ctx->pep));
+  if (ctx->subc) PetscCall(PetscSubcommDestroy(&ctx->subc));
+  if (ctx->commset) {
+    PetscCallMPI(MPI_Comm_free(&ctx->commrank));
+    ctx->commset = PETSC_FALSE;
+  }
+  PetscCall(PetscFree(ctx->subintervals));
+  PetscCall(PetscFree(ctx->nconv_loc));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -472,6 +494,154 @@ static PetscErrorCode PEPBackTransform_Skip(PEP pep)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   PEPQSliceGetChildPEP - Creates the subcommunicators and the auxiliary PEP object
+   that computes the eigenvalues of the subinterval assigned to the subcommunicator
+   of the calling process, with redundant copies of the coefficient matrices
+*/
+static PetscErrorCode PEPQSliceGetChildPEP(PEP pep)
+{
+  PEP_STOAR      *ctx=(PEP_STOAR*)pep->data;
+  Mat            Ar[3];
+  ST             st;
+  KSP            ksp,kspl;
+  PC             pc,pcl;
+  KSPType        ksptype;
+  PCType         pctype;
+  MatSolverType  stype;
+  STType         sttype;
+  MatStructure   str;
+  PetscInt       i;
+  PetscMPIInt    rank;
+  PetscReal      a,b,h;
+  const char     *prefix;
+  MPI_Comm       child;
+
+  PetscFunctionBegin;
+  if (!ctx->subc) {
+    /* Create context for subcommunicators */
+    PetscCall(PetscSubcommCreate(PetscObjectComm((PetscObject)pep),&ctx->subc));
+    PetscCall(PetscSubcommSetNumber(ctx->subc,ctx->npart));
+    PetscCall(PetscSubcommSetType(ctx->subc,PETSC_SUBCOMM_CONTIGUOUS));
+  }
+  PetscCall(PetscSubcommGetChild(ctx->subc,&child));
+  /* Create subcommunicator grouping processes with same rank */
+  if (!ctx->commset) {
+    PetscCallMPI(MPI_Comm_rank(child,&rank));
+    PetscCallMPI(MPI_Comm_split(PetscObjectComm((PetscObject)pep),rank,ctx->subc->color,&ctx->commrank));
+    ctx->commset = PETSC_TRUE;
+  }
+
+  /* Create auxiliary PEP */
+  if (!ctx->pep) {
+    PetscCall(PEPCreate(child,&ctx->pep));
+    PetscCall(PEPGetOptionsPrefix(pep,&prefix));
+    PetscCall(PEPSetOptionsPrefix(ctx->pep,prefix));
+    PetscCall(PEPSetType(ctx->pep,PEPSTOAR));
+  }
+
+  /* Duplicate matrices */
+  for (i=0;i<pep->nmat;i++) {
+    PetscCall(MatCreateRedundantMatrix(pep->A[i],0,child,MAT_INITIAL_MATRIX,&Ar[i]));
+    PetscCall(MatPropagateSymmetryOptions(pep->A[i],Ar[i]));
+  }
+  PetscCall(PEPSetOperators(ctx->pep,pep->nmat,Ar));
+  for (i=0;i<pep->nmat;i++) PetscCall(MatDestroy(&Ar[i]));
+
+  /* Determine subintervals */
+  if (!ctx->subintset) { /* uniform distribution if no set by user */
+    PetscCheck(pep->inta>PETSC_MIN_REAL && pep->intb<PETSC_MAX_REAL,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"Global interval must be bounded for splitting it in uniform subintervals");
+    h = (pep->intb-pep->inta)/ctx->npart;
+    PetscCall(PetscFree(ctx->subintervals));
+    PetscCall(PetscMalloc1(ctx->npart+1,&ctx->subintervals));
+    for (i=0;i<ctx->npart;i++) ctx->subintervals[i] = pep->inta+h*i;
+    ctx->subintervals[ctx->npart] = pep->intb;
+  }
+  a = ctx->subintervals[ctx->subc->color];
+  b = ctx->subintervals[ctx->subc->color+1];
+
+  /* Transfer settings from the global PEP */
+  PetscCall(PEPSetProblemType(ctx->pep,pep->problem_type));
+  PetscCall(PEPSetInterval(ctx->pep,a,b));
+  PetscCall(PEPSetWhichEigenpairs(ctx->pep,PEP_ALL));
+  PetscCall(PEPSetTolerances(ctx->pep,pep->tol,pep->max_it));
+  PetscCall(PEPSetConvergenceTest(ctx->pep,pep->conv));
+  PetscCall(PEPSTOARSetDimensions(ctx->pep,ctx->nev,ctx->ncv,ctx->mpd));
+  PetscCall(PEPSTOARSetLocking(ctx->pep,ctx->lock));
+  PetscCall(PEPSTOARSetDetectZeros(ctx->pep,ctx->detect));
+  PetscCall(PEPSTOARSetLinearization(ctx->pep,ctx->alpha,ctx->beta));
+  PetscCall(PEPSTOARSetCheckEigenvalueType(ctx->pep,ctx->checket));
+
+  /* Transfer options of the spectral transformation and the linear solver */
+  PetscCall(PEPGetST(ctx->pep,&st));
+  PetscCall(STGetType(pep->st,&sttype));
+  PetscCall(STSetType(st,sttype));
+  PetscCall(STGetMatStructure(pep->st,&str));
+  PetscCall(STSetMatStructure(st,str));
+  PetscCall(STGetKSP(pep->st,&ksp));
+  PetscCall(KSPGetPC(ksp,&pc));
+  PetscCall(KSPGetType(ksp,&ksptype));
+  PetscCall(PCGetType(pc,&pctype));
+  PetscCall(PCFactorGetMatSolverType(pc,&stype));
+  PetscCall(STGetKSP(st,&kspl));
+  PetscCall(KSPGetPC(kspl,&pcl));
+  if (ksptype) PetscCall(KSPSetType(kspl,ksptype));
+  if (pctype) PetscCall(PCSetType(pcl,pctype));
+  if (stype) PetscCall(PCFactorSetMatSolverType(pcl,stype));
+  PetscCall(STSetFromOptions(st));
+
+  PetscCall(PEPSetUp(ctx->pep));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   PEPSetUp_STOAR_QSlice_Partitions - Setup of the global PEP when the communicator
+   is split in several partitions, each one processing a subinterval
+*/
+static PetscErrorCode PEPSetUp_STOAR_QSlice_Partitions(PEP pep)
+{
+  PEP_STOAR      *ctx=(PEP_STOAR*)pep->data,*ctx_local;
+  PEP_SR         sr=ctx->sr,sr_loc;
+  PetscInt       i,inertia0,inertia1;
+  PetscMPIInt    rank,aux;
+  MPI_Comm       child;
+
+  PetscFunctionBegin;
+  PetscCall(PEPQSliceGetChildPEP(pep));
+  ctx_local = (PEP_STOAR*)ctx->pep->data;
+  sr_loc = ctx_local->sr;
+
+  /* Gather the number of eigenvalues in each subinterval */
+  PetscCall(PetscFree(ctx->nconv_loc));
+  PetscCall(PetscMalloc1(ctx->npart,&ctx->nconv_loc));
+  PetscCall(PetscSubcommGetChild(ctx->subc,&child));
+  PetscCallMPI(MPI_Comm_rank(child,&rank));
+  inertia0 = (sr_loc->dir==1)?sr_loc->inertia0:sr_loc->inertia1;
+  inertia1 = (sr_loc->dir==1)?sr_loc->inertia1:sr_loc->inertia0;
+  if (!rank) {
+    PetscCall(PetscMPIIntCast(sr_loc->numEigs,&aux));
+    PetscCallMPI(MPI_Allgather(&aux,1,MPI_INT,ctx->nconv_loc,1,MPI_INT,ctx->commrank));
+    PetscCallMPI(MPI_Bcast(&inertia0,1,MPIU_INT,0,ctx->commrank));
+    PetscCall(PetscMPIIntCast(ctx->npart-1,&aux));
+    PetscCallMPI(MPI_Bcast(&inertia1,1,MPIU_INT,aux,ctx->commrank));
+  }
+  PetscCall(PetscMPIIntCast(ctx->npart,&aux));
+  PetscCallMPI(MPI_Bcast(ctx->nconv_loc,aux,MPI_INT,0,child));
+  PetscCallMPI(MPI_Bcast(&inertia0,1,MPIU_INT,0,child));
+  PetscCallMPI(MPI_Bcast(&inertia1,1,MPIU_INT,0,child));
+
+  /* Inertias at the endpoints of the global interval */
+  sr->inertia0 = (sr->dir==1)?inertia0:inertia1;
+  sr->inertia1 = (sr->dir==1)?inertia1:inertia0;
+  sr->numEigs = 0;
+  for (i=0;i<ctx->npart;i++) sr->numEigs += ctx->nconv_loc[i];
+  PetscCall(PetscInfo(pep,"QSlice setup: %" PetscInt_FMT " eigenvalues in [%g,%g] distributed in %" PetscInt_FMT " partitions\n",sr->numEigs,(double)pep->inta,(double)pep->intb,ctx->npart));
+  pep->nev = sr->numEigs;
+  pep->ncv = sr->numEigs;
+  pep->mpd = sr->numEigs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode PEPSetUp_STOAR_QSlice(PEP pep)
 {
   PEP_STOAR      *ctx=(PEP_STOAR*)pep->data;
@@ -529,6 +699,11 @@ PetscErrorCode PEPSetUp_STOAR_QSlice(PEP pep)
     sr->hasEnd = PetscNot(pep->inta <= PETSC_MIN_REAL);
   }
 
+  if (ctx->npart>1) {
+    PetscCall(PEPSetUp_STOAR_QSlice_Partitions(pep));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
   /* compute inertia0 */
   PetscCall(PEPQSliceGetInertia(pep,sr->int0,&sr->inertia0,ctx->detect?&zeros:NULL,ctx->hyperbolic?0:1));
   PetscCheck(!zeros || (sr->int0!=pep->inta && sr->int0!=pep->intb),((PetscObject)pep)->comm,PETSC_ERR_USER,"Found singular matrix for the transformed problem in the interval endpoint");
@@ -1365,6 +1540,121 @@ static PetscErrorCode PEPQSliceGetInertias(PEP pep,PetscInt *n,PetscReal **shift
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   PEPQSliceGatherSolution - Collect in the global PEP the eigenvalues, eigenvectors
+   and shifts computed in each of the subcommunicators
+*/
+static PetscErrorCode PEPQSliceGatherSolution(PEP pep)
+{
+  PEP_STOAR      *ctx=(PEP_STOAR*)pep->data,*ctx_local=(PEP_STOAR*)ctx->pep->data;
+  PEP            pepl=ctx->pep;
+  PetscMPIInt    rank,aux,*disp,*ns_loc;
+  PetscInt       i,j,si,idx,nloc,n0,m0,ns,*idx1,*idx2,its=0;
+  PetscScalar    *array;
+  Vec            v,vg,v_loc;
+  IS             is1,is2;
+  VecScatter     vec_sc;
+  MPI_Comm       child;
+
+  PetscFunctionBegin;
+  PetscCall(PetscSubcommGetChild(ctx->subc,&child));
+  PetscCallMPI(MPI_Comm_rank(child,&rank));
+
+  /* Number of eigenpairs and shifts of each subinterval */
+  ns = pepl->nconv? ctx_local->nshifts: 0;
+  if (ctx->subc->color<ctx->npart-1 && ns>0 && ctx_local->shifts[ns-1]==ctx->subintervals[ctx->subc->color+1]) ns--;  /* shared endpoint */
+  PetscCall(PetscMalloc2(ctx->npart,&ns_loc,ctx->npart,&disp));
+  if (!rank) {
+    PetscCall(PetscMPIIntCast(pepl->nconv,&aux));
+    PetscCallMPI(MPI_Allgather(&aux,1,MPI_INT,ctx->nconv_loc,1,MPI_INT,ctx->commrank));
+    PetscCall(PetscMPIIntCast(ns,&aux));
+    PetscCallMPI(MPI_Allgather(&aux,1,MPI_INT,ns_loc,1,MPI_INT,ctx->commrank));
+  }
+  PetscCall(PetscMPIIntCast(ctx->npart,&aux));
+  PetscCallMPI(MPI_Bcast(ctx->nconv_loc,aux,MPI_INT,0,child));
+  PetscCallMPI(MPI_Bcast(ns_loc,aux,MPI_INT,0,child));
+  pep->nconv = 0;
+  for (i=0;i<ctx->npart;i++) pep->nconv += ctx->nconv_loc[i];
+  PetscCheck(pep->nconv<=ctx->sr->numEigs,PetscObjectComm((PetscObject)pep),PETSC_ERR_PLIB,"Mismatch between number of values found in subintervals and information from inertia");
+  ctx->nshifts = 0;
+  for (i=0;i<ctx->npart;i++) ctx->nshifts += ns_loc[i];
+  PetscCall(PetscFree(ctx->inertias));
+  PetscCall(PetscFree(ctx->shifts));
+  PetscCall(PetscMalloc1(ctx->nshifts,&ctx->inertias));
+  PetscCall(PetscMalloc1(ctx->nshifts,&ctx->shifts));
+
+  /* Gather eigenvalues, error estimates and shifts (processes with the same rank hold the same data) */
+  if (!rank) {
+    disp[0] = 0;
+    for (i=1;i<ctx->npart;i++) disp[i] = disp[i-1]+ctx->nconv_loc[i-1];
+    PetscCall(PetscMPIIntCast(pepl->nconv,&aux));
+    PetscCallMPI(MPI_Allgatherv(pepl->eigr,aux,MPIU_SCALAR,pep->eigr,ctx->nconv_loc,disp,MPIU_SCALAR,ctx->commrank));
+    PetscCallMPI(MPI_Allgatherv(pepl->eigi,aux,MPIU_SCALAR,pep->eigi,ctx->nconv_loc,disp,MPIU_SCALAR,ctx->commrank));
+    PetscCallMPI(MPI_Allgatherv(pepl->errest,aux,MPIU_REAL,pep->errest,ctx->nconv_loc,disp,MPIU_REAL,ctx->commrank));
+    for (i=1;i<ctx->npart;i++) disp[i] = disp[i-1]+ns_loc[i-1];
+    PetscCall(PetscMPIIntCast(ns,&aux));
+    PetscCallMPI(MPI_Allgatherv(ctx_local->shifts,aux,MPIU_REAL,ctx->shifts,ns_loc,disp,MPIU_REAL,ctx->commrank));
+    PetscCallMPI(MPI_Allgatherv(ctx_local->inertias,aux,MPIU_INT,ctx->inertias,ns_loc,disp,MPIU_INT,ctx->commrank));
+    PetscCallMPI(MPIU_Allreduce(&pepl->its,&its,1,MPIU_INT,MPI_SUM,ctx->commrank));
+  }
+  PetscCall(PetscMPIIntCast(pep->nconv,&aux));
+  PetscCallMPI(MPI_Bcast(pep->eigr,aux,MPIU_SCALAR,0,child));
+  PetscCallMPI(MPI_Bcast(pep->eigi,aux,MPIU_SCALAR,0,child));
+  PetscCallMPI(MPI_Bcast(pep->errest,aux,MPIU_REAL,0,child));
+  PetscCall(PetscMPIIntCast(ctx->nshifts,&aux));
+  PetscCallMPI(MPI_Bcast(ctx->shifts,aux,MPIU_REAL,0,child));
+  PetscCallMPI(MPI_Bcast(ctx->inertias,aux,MPIU_INT,0,child));
+  PetscCallMPI(MPI_Bcast(&its,1,MPIU_INT,0,child));
+  pep->its = its;
+  for (i=0;i<pep->nconv;i++) pep->perm[i] = i;
+
+  /* Gather parallel eigenvectors */
+  PetscCall(BVGetColumn(pep->V,0,&v));
+  PetscCall(VecGetOwnershipRange(v,&n0,&m0));
+  PetscCall(BVRestoreColumn(pep->V,0,&v));
+  PetscCall(BVGetColumn(pepl->V,0,&v));
+  PetscCall(VecGetLocalSize(v,&nloc));
+  PetscCall(BVRestoreColumn(pepl->V,0,&v));
+  PetscCall(PetscMalloc2(m0-n0,&idx1,m0-n0,&idx2));
+  PetscCall(VecCreateMPI(PetscObjectComm((PetscObject)pep),nloc,PETSC_DECIDE,&vg));
+  idx = -1;
+  for (si=0;si<ctx->npart;si++) {
+    j = 0;
+    for (i=n0;i<m0;i++) {
+      idx1[j]   = i;
+      idx2[j++] = i+pep->n*si;
+    }
+    PetscCall(ISCreateGeneral(PetscObjectComm((PetscObject)pep),(m0-n0),idx1,PETSC_COPY_VALUES,&is1));
+    PetscCall(ISCreateGeneral(PetscObjectComm((PetscObject)pep),(m0-n0),idx2,PETSC_COPY_VALUES,&is2));
+    PetscCall(BVGetColumn(pep->V,0,&v));
+    PetscCall(VecScatterCreate(v,is1,vg,is2,&vec_sc));
+    PetscCall(BVRestoreColumn(pep->V,0,&v));
+    PetscCall(ISDestroy(&is1));
+    PetscCall(ISDestroy(&is2));
+    for (i=0;i<ctx->nconv_loc[si];i++) {
+      PetscCall(BVGetColumn(pep->V,++idx,&v));
+      if (ctx->subc->color==si) {
+        PetscCall(BVGetColumn(pepl->V,i,&v_loc));
+        PetscCall(VecGetArray(v_loc,&array));
+        PetscCall(VecPlaceArray(vg,array));
+      }
+      PetscCall(VecScatterBegin(vec_sc,vg,v,INSERT_VALUES,SCATTER_REVERSE));
+      PetscCall(VecScatterEnd(vec_sc,vg,v,INSERT_VALUES,SCATTER_REVERSE));
+      if (ctx->subc->color==si) {
+        PetscCall(VecResetArray(vg));
+        PetscCall(VecRestoreArray(v_loc,&array));
+        PetscCall(BVRestoreColumn(pepl->V,i,&v_loc));
+      }
+      PetscCall(BVRestoreColumn(pep->V,idx,&v));
+    }
+    PetscCall(VecScatterDestroy(&vec_sc));
+  }
+  PetscCall(PetscFree2(idx1,idx2));
+  PetscCall(PetscFree2(ns_loc,disp));
+  PetscCall(VecDestroy(&vg));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 PetscErrorCode PEPSolve_STOAR_QSlice(PEP pep)
 {
   PetscInt       i,j,ti,deg=pep->nmat-1;
@@ -1377,6 +1667,19 @@ PetscErrorCode PEPSolve_STOAR_QSlice(PEP pep)
   PetscFunctionBegin;
   PetscCall(PetscCitationsRegister(citation,&cited));
 
+  if (ctx->npart>1) {
+    /* Each subcommunicator processes its own subinterval */
+    ctx->pep->nconv = 0;
+    ctx->pep->its   = 0;
+    PetscCall(PEPSolve_STOAR_QSlice(ctx->pep));
+    ctx->pep->state = PEP_STATE_SOLVED;
+    /* Gather solution from subsolvers */
+    if (sr->numEigs) PetscCall(PEPQSliceGatherSolution(pep));
+    pep->nev    = pep->nconv;
+    pep->reason = PEP_CONVERGED_TOL;
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+
   /* Only with eigenvalues present in the interval ...*/
   if (sr->numEigs==0) {
     pep->reason = PEP_CONVERGED_TOL;
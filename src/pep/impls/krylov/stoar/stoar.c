@@ -499,6 +499,10 @@ static PetscErrorCode PEPSetFromOptions_STOAR(PEP pep,PetscOptionItems *PetscOpt
     PetscCall(PetscOptionsRealArray("-pep_stoar_linearization","Parameters of the linearization","PEPSTOARSetLinearization",array,&k,&flg));
     if (flg) PetscCall(PEPSTOARSetLinearization(pep,array[0],array[1]));
 
+    i = ctx->npart;
+    PetscCall(PetscOptionsInt("-pep_stoar_partitions","Number of partitions of the communicator for spectrum slicing","PEPSTOARSetPartitions",ctx->npart,&i,&flg));
+    if (flg) PetscCall(PEPSTOARSetPartitions(pep,i));
+
     b = ctx->checket;
     PetscCall(PetscOptionsBool("-pep_stoar_check_eigenvalue_type","Check eigenvalue type during spectrum slicing","PEPSTOARSetCheckEigenvalueType",ctx->checket,&b,&flg));
     if (flg) PetscCall(PEPSTOARSetCheckEigenvalueType(pep,b));
@@ -1008,6 +1012,149 @@ PetscErrorCode PEPSTOARGetCheckEigenvalueType(PEP pep,PetscBool *checket)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode PEPSTOARSetPartitions_STOAR(PEP pep,PetscInt npart)
+{
+  PEP_STOAR   *ctx = (PEP_STOAR*)pep->data;
+  PetscMPIInt size;
+  PetscInt    newnpart;
+
+  PetscFunctionBegin;
+  if (npart == PETSC_DEFAULT || npart == PETSC_DECIDE) {
+    newnpart = 1;
+  } else {
+    PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)pep),&size));
+    PetscCheck(npart>0 && npart<=size,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of npart");
+    newnpart = npart;
+  }
+  if (ctx->npart!=newnpart) {
+    PetscCall(PEPDestroy_STOAR_QSlice(pep));
+    ctx->subintset = PETSC_FALSE;
+    ctx->npart = newnpart;
+    pep->state = PEP_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPSTOARSetPartitions - Sets the number of partitions for the
+   case of doing spectrum slicing for a computational interval with the
+   communicator split in several sub-communicators.
+
+   Logically Collective
+
+   Input Parameters:
++  pep   - the eigenproblem solver context
+-  npart - number of partitions
+
+   Options Database Key:
+.  -pep_stoar_partitions <npart> - Sets the number of partitions
+
+   Notes:
+   By default, npart=1 so all processes in the communicator participate in
+   the processing of the whole interval. If npart>1 then the interval is
+   divided into npart subintervals, each of them being processed by a
+   subset of processes, with its own STOAR solver and factorizations.
+   The computed eigenpairs are gathered in the global communicator at the end.
+
+   The interval is split proportionally unless the separation points are
+   specified with PEPSTOARSetSubintervals().
+
+   Level: advanced
+
+.seealso: PEPSTOARSetSubintervals(), PEPSetInterval()
+@*/
+PetscErrorCode PEPSTOARSetPartitions(PEP pep,PetscInt npart)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscValidLogicalCollectiveInt(pep,npart,2);
+  PetscTryMethod(pep,"PEPSTOARSetPartitions_C",(PEP,PetscInt),(pep,npart));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PEPSTOARGetPartitions_STOAR(PEP pep,PetscInt *npart)
+{
+  PEP_STOAR *ctx = (PEP_STOAR*)pep->data;
+
+  PetscFunctionBegin;
+  *npart = ctx->npart;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPSTOARGetPartitions - Gets the number of partitions of the
+   communicator in case of spectrum slicing.
+
+   Not Collective
+
+   Input Parameter:
+.  pep - the eigenproblem solver context
+
+   Output Parameter:
+.  npart - number of partitions
+
+   Level: advanced
+
+.seealso: PEPSTOARSetPartitions()
+@*/
+PetscErrorCode PEPSTOARGetPartitions(PEP pep,PetscInt *npart)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscAssertPointer(npart,2);
+  PetscUseMethod(pep,"PEPSTOARGetPartitions_C",(PEP,PetscInt*),(pep,npart));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PEPSTOARSetSubintervals_STOAR(PEP pep,PetscReal *subint)
+{
+  PEP_STOAR *ctx = (PEP_STOAR*)pep->data;
+  PetscInt  i;
+
+  PetscFunctionBegin;
+  PetscCheck(subint[0]==pep->inta && subint[ctx->npart]==pep->intb,PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"First and last values must match the endpoints of PEPSetInterval()");
+  for (i=0;i<ctx->npart;i++) PetscCheck(subint[i]<subint[i+1],PetscObjectComm((PetscObject)pep),PETSC_ERR_ARG_WRONG,"Array must contain values in strictly ascending order");
+  PetscCall(PetscFree(ctx->subintervals));
+  PetscCall(PetscMalloc1(ctx->npart+1,&ctx->subintervals));
+  for (i=0;i<ctx->npart+1;i++) ctx->subintervals[i] = subint[i];
+  ctx->subintset = PETSC_TRUE;
+  pep->state = PEP_STATE_INITIAL;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   PEPSTOARSetSubintervals - Sets the points that delimit the
+   subintervals to be used in spectrum slicing with several partitions.
+
+   Logically Collective
+
+   Input Parameters:
++  pep    - the eigenproblem solver context
+-  subint - array of real values specifying subintervals
+
+   Notes:
+   This function must be called after PEPSTOARSetPartitions(). For npart
+   partitions, the argument subint must contain npart+1 real values sorted in
+   ascending order, subint_0, subint_1, ..., subint_npart, where the first
+   and last values must coincide with the interval endpoints set with
+   PEPSetInterval().
+
+   The subintervals are then defined by two consecutive points [subint_0,subint_1],
+   [subint_1,subint_2], and so on. The points subint_1, ..., subint_npart-1 should
+   not coincide with eigenvalues, since the inertia is computed at them.
+
+   Level: advanced
+
+.seealso: PEPSTOARSetPartitions(), PEPSetInterval()
+@*/
+PetscErrorCode PEPSTOARSetSubintervals(PEP pep,PetscReal *subint)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(pep,PEP_CLASSID,1);
+  PetscTryMethod(pep,"PEPSTOARSetSubintervals_C",(PEP,PetscReal*),(pep,subint));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode PEPView_STOAR(PEP pep,PetscViewer viewer)
 {
   PEP_STOAR      *ctx = (PEP_STOAR*)pep->data;
@@ -1019,6 +1166,7 @@ static PetscErrorCode PEPView_STOAR(PEP pep,PetscViewer viewer)
     PetscCall(PetscViewerASCIIPrintf(viewer,"  using the %slocking variant\n",ctx->lock?"":"non-"));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  linearization parameters: alpha=%g beta=%g\n",(double)ctx->alpha,(double)ctx->beta));
     if (pep->which==PEP_ALL && !ctx->hyperbolic) PetscCall(PetscViewerASCIIPrintf(viewer,"  checking eigenvalue type: %s\n",ctx->checket?"enabled":"disabled"));
+    if (pep->which==PEP_ALL && ctx->npart>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  multi-communicator spectrum slicing with %" PetscInt_FMT " partitions\n",ctx->npart));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -1036,6 +1184,7 @@ static PetscErrorCode PEPDestroy_STOAR(PEP pep)
 
   PetscFunctionBegin;
   PetscCall(BVDestroy(&ctx->V));
+  PetscCall(PEPDestroy_STOAR_QSlice(pep));
   PetscCall(PetscFree(pep->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetLocking_C",NULL));
@@ -1048,6 +1197,9 @@ static PetscErrorCode PEPDestroy_STOAR(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetLinearization_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetCheckEigenvalueType_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetCheckEigenvalueType_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetPartitions_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetPartitions_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetSubintervals_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1067,6 +1219,7 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_STOAR(PEP pep)
   ctx->alpha    = 1.0;
   ctx->beta     = 0.0;
   ctx->checket  = PETSC_TRUE;
+  ctx->npart    = 1;
 
   pep->ops->setup          = PEPSetUp_STOAR;
   pep->ops->setfromoptions = PEPSetFromOptions_STOAR;
@@ -1088,5 +1241,8 @@ SLEPC_EXTERN PetscErrorCode PEPCreate_STOAR(PEP pep)
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetLinearization_C",PEPSTOARGetLinearization_STOAR));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetCheckEigenvalueType_C",PEPSTOARSetCheckEigenvalueType_STOAR));
   PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetCheckEigenvalueType_C",PEPSTOARGetCheckEigenvalueType_STOAR));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetPartitions_C",PEPSTOARSetPartitions_STOAR));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARGetPartitions_C",PEPSTOARGetPartitions_STOAR));
+  PetscCall(PetscObjectComposeFunction((PetscObject)pep,"PEPSTOARSetSubintervals_C",PEPSTOARSetSubintervals_STOAR));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
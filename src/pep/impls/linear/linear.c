@@ -14,14 +14,21 @@
 #include <slepc/private/pepimpl.h>         /*I "slepcpep.h" I*/
 #include "linear.h"
 
+/*
+   Both shell operators below work on the stacked vector of deg blocks of size m.
+   The parts involving the three-term recurrence of the polynomial basis are
+   computed in a single sweep over the local arrays, while the parts involving
+   the coefficient matrices use work vectors that share the memory of the
+   corresponding blocks (VecPlaceArray), so that no block is copied.
+*/
 static PetscErrorCode MatMult_Linear_Shift(Mat M,Vec x,Vec y)
 {
   PEP_LINEAR        *ctx;
   PEP               pep;
   const PetscScalar *px;
   PetscScalar       *py,a,sigma=0.0;
-  PetscInt          nmat,deg,i,m;
-  Vec               x1,x2,x3,y1,aux;
+  PetscInt          nmat,deg,i,j,m;
+  Vec               x1,x2,y1,aux,aux2;
   PetscReal         *ca,*cb,*cg;
   PetscBool         flg;
 
@@ -36,54 +43,35 @@ static PetscErrorCode MatMult_Linear_Shift(Mat M,Vec x,Vec y)
   ca = pep->pbc;
   cb = pep->pbc+nmat;
   cg = pep->pbc+2*nmat;
-  x1=ctx->w[0];x2=ctx->w[1];x3=ctx->w[2];y1=ctx->w[3];aux=ctx->w[4];
+  x1=ctx->w[0];x2=ctx->w[1];y1=ctx->w[3];aux=ctx->w[4];aux2=ctx->w[5];
 
-  PetscCall(VecSet(y,0.0));
   PetscCall(VecGetArrayRead(x,&px));
   PetscCall(VecGetArray(y,&py));
-  a = 1.0;
 
-  /* first block */
-  PetscCall(VecPlaceArray(x2,px));
-  PetscCall(VecPlaceArray(x3,px+m));
-  PetscCall(VecPlaceArray(y1,py));
-  PetscCall(VecAXPY(y1,cb[0]-sigma,x2));
-  PetscCall(VecAXPY(y1,ca[0],x3));
-  PetscCall(VecResetArray(x2));
-  PetscCall(VecResetArray(x3));
-  PetscCall(VecResetArray(y1));
-
-  /* inner blocks */
+  /* first and inner blocks */
+  for (j=0;j<m;j++) py[j] = (cb[0]-sigma)*px[j]+ca[0]*px[m+j];
   for (i=1;i<deg-1;i++) {
-    PetscCall(VecPlaceArray(x1,px+(i-1)*m));
-    PetscCall(VecPlaceArray(x2,px+i*m));
-    PetscCall(VecPlaceArray(x3,px+(i+1)*m));
-    PetscCall(VecPlaceArray(y1,py+i*m));
-    PetscCall(VecAXPY(y1,cg[i],x1));
-    PetscCall(VecAXPY(y1,cb[i]-sigma,x2));
-    PetscCall(VecAXPY(y1,ca[i],x3));
-    PetscCall(VecResetArray(x1));
-    PetscCall(VecResetArray(x2));
-    PetscCall(VecResetArray(x3));
-    PetscCall(VecResetArray(y1));
+    for (j=0;j<m;j++) py[i*m+j] = cg[i]*px[(i-1)*m+j]+(cb[i]-sigma)*px[i*m+j]+ca[i]*px[(i+1)*m+j];
   }
 
   /* last block */
-  PetscCall(VecPlaceArray(y1,py+(deg-1)*m));
-  for (i=0;i<deg;i++) {
+  a = 1.0;
+  PetscCall(VecPlaceArray(x1,px));
+  PetscCall(STMatMult(pep->st,0,x1,aux));
+  PetscCall(VecResetArray(x1));
+  for (i=1;i<deg;i++) {
+    a *= pep->sfactor;
     PetscCall(VecPlaceArray(x1,px+i*m));
-    PetscCall(STMatMult(pep->st,i,x1,aux));
-    PetscCall(VecAXPY(y1,a,aux));
+    PetscCall(STMatMult(pep->st,i,x1,aux2));
+    PetscCall(VecAXPY(aux,a,aux2));
     PetscCall(VecResetArray(x1));
-    a *= pep->sfactor;
   }
-  PetscCall(VecCopy(y1,aux));
+  a *= pep->sfactor;
+  PetscCall(VecPlaceArray(y1,py+(deg-1)*m));
   PetscCall(STMatSolve(pep->st,aux,y1));
-  PetscCall(VecScale(y1,-ca[deg-1]/a));
   PetscCall(VecPlaceArray(x1,px+(deg-2)*m));
   PetscCall(VecPlaceArray(x2,px+(deg-1)*m));
-  PetscCall(VecAXPY(y1,cg[deg-1],x1));
-  PetscCall(VecAXPY(y1,cb[deg-1]-sigma,x2));
+  PetscCall(VecAXPBYPCZ(y1,cg[deg-1],cb[deg-1]-sigma,-ca[deg-1]/a,x1,x2));
   PetscCall(VecResetArray(x1));
   PetscCall(VecResetArray(x2));
   PetscCall(VecResetArray(y1));
@@ -99,7 +87,7 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
   PEP               pep;
   const PetscScalar *px;
   PetscScalar       *py,a,sigma,t=1.0,tp=0.0,tt;
-  PetscInt          nmat,deg,i,m;
+  PetscInt          nmat,deg,i,j,m;
   Vec               x1,y1,y2,y3,aux,aux2;
   PetscReal         *ca,*cb,*cg;
 
@@ -114,49 +102,20 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
   cg = pep->pbc+2*nmat;
   x1=ctx->w[0];y1=ctx->w[1];y2=ctx->w[2];y3=ctx->w[3];aux=ctx->w[4];aux2=ctx->w[5];
   PetscCall(EPSGetTarget(ctx->eps,&sigma));
-  PetscCall(VecSet(y,0.0));
   PetscCall(VecGetArrayRead(x,&px));
   PetscCall(VecGetArray(y,&py));
   a = pep->sfactor;
 
-  /* first block */
-  PetscCall(VecPlaceArray(x1,px));
-  PetscCall(VecPlaceArray(y1,py+m));
-  PetscCall(VecCopy(x1,y1));
-  PetscCall(VecScale(y1,1.0/ca[0]));
-  PetscCall(VecResetArray(x1));
-  PetscCall(VecResetArray(y1));
-
-  /* second block */
-  if (deg>2) {
-    PetscCall(VecPlaceArray(x1,px+m));
-    PetscCall(VecPlaceArray(y1,py+m));
-    PetscCall(VecPlaceArray(y2,py+2*m));
-    PetscCall(VecCopy(x1,y2));
-    PetscCall(VecAXPY(y2,sigma-cb[1],y1));
-    PetscCall(VecScale(y2,1.0/ca[1]));
-    PetscCall(VecResetArray(x1));
-    PetscCall(VecResetArray(y1));
-    PetscCall(VecResetArray(y2));
+  /* blocks 1 to deg-1, three-term recurrence with zero first block */
+  for (j=0;j<m;j++) {
+    py[j]   = 0.0;
+    py[m+j] = px[j]/ca[0];
   }
-
-  /* inner blocks */
-  for (i=2;i<deg-1;i++) {
-    PetscCall(VecPlaceArray(x1,px+i*m));
-    PetscCall(VecPlaceArray(y1,py+(i-1)*m));
-    PetscCall(VecPlaceArray(y2,py+i*m));
-    PetscCall(VecPlaceArray(y3,py+(i+1)*m));
-    PetscCall(VecCopy(x1,y3));
-    PetscCall(VecAXPY(y3,sigma-cb[i],y2));
-    PetscCall(VecAXPY(y3,-cg[i],y1));
-    PetscCall(VecScale(y3,1.0/ca[i]));
-    PetscCall(VecResetArray(x1));
-    PetscCall(VecResetArray(y1));
-    PetscCall(VecResetArray(y2));
-    PetscCall(VecResetArray(y3));
+  for (i=1;i<deg-1;i++) {
+    for (j=0;j<m;j++) py[(i+1)*m+j] = (px[i*m+j]+(sigma-cb[i])*py[i*m+j]-cg[i]*py[(i-1)*m+j])/ca[i];
   }
 
-  /* last block */
+  /* last block, accumulated in the first block */
   PetscCall(VecPlaceArray(y1,py));
   for (i=0;i<deg-2;i++) {
     PetscCall(VecPlaceArray(y2,py+(i+1)*m));
@@ -168,8 +127,7 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
   i = deg-2;
   PetscCall(VecPlaceArray(y2,py+(i+1)*m));
   PetscCall(VecPlaceArray(y3,py+i*m));
-  PetscCall(VecCopy(y2,aux2));
-  PetscCall(VecAXPY(aux2,cg[i+1]/ca[i+1],y3));
+  PetscCall(VecWAXPY(aux2,cg[i+1]/ca[i+1],y3,y2));
   PetscCall(STMatMult(pep->st,i+1,aux2,aux));
   PetscCall(VecAXPY(y1,a,aux));
   PetscCall(VecResetArray(y2));
@@ -178,28 +136,23 @@ static PetscErrorCode MatMult_Linear_Sinvert(Mat M,Vec x,Vec y)
   i = deg-1;
   PetscCall(VecPlaceArray(x1,px+i*m));
   PetscCall(VecPlaceArray(y3,py+i*m));
-  PetscCall(VecCopy(x1,aux2));
-  PetscCall(VecAXPY(aux2,sigma-cb[i],y3));
-  PetscCall(VecScale(aux2,1.0/ca[i]));
+  PetscCall(VecAXPBYPCZ(aux2,1.0/ca[i],(sigma-cb[i])/ca[i],0.0,x1,y3));
   PetscCall(STMatMult(pep->st,i+1,aux2,aux));
   PetscCall(VecAXPY(y1,a,aux));
   PetscCall(VecResetArray(x1));
   PetscCall(VecResetArray(y3));
 
-  PetscCall(VecCopy(y1,aux));
-  PetscCall(STMatSolve(pep->st,aux,y1));
-  PetscCall(VecScale(y1,-1.0));
+  PetscCall(STMatSolve(pep->st,y1,aux));
+  PetscCall(VecAXPBY(y1,-1.0,0.0,aux));
+  PetscCall(VecResetArray(y1));
 
-  /* final update */
+  /* final update of blocks 1 to deg-1 with the basis polynomials evaluated at sigma */
   for (i=1;i<deg;i++) {
-    PetscCall(VecPlaceArray(y2,py+i*m));
     tt = t;
     t = ((sigma-cb[i-1])*t-cg[i-1]*tp)/ca[i-1]; /* i-th basis polynomial */
     tp = tt;
-    PetscCall(VecAXPY(y2,t,y1));
-    PetscCall(VecResetArray(y2));
+    for (j=0;j<m;j++) py[i*m+j] += t*py[j];
   }
-  PetscCall(VecResetArray(y1));
 
   PetscCall(VecRestoreArrayRead(x,&px));
   PetscCall(VecRestoreArray(y,&py));
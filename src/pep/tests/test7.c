@@ -168,7 +168,15 @@ int main(int argc,char **argv)
 /*TEST
 
    test:
+      suffix: 1
       requires: !single
       args: -showinertia 0
 
+   test:
+      suffix: 2
+      nsize: 2
+      requires: mumps !single
+      args: -showinertia 0 -pep_stoar_partitions 2 -st_pc_factor_mat_solver_type mumps -st_mat_mumps_icntl_13 1
+      output_file: output/test7_1.out
+
 TEST*/
@@ -146,11 +146,16 @@ int main(int argc,char **argv)
          args: -mat_type aijhipsparse
          requires: hip
 
-   test:
-      suffix: 2
+   testset:
       args: -pep_type jd -pep_jd_minimality_index 1 -pep_nev 4 -n 24 -pep_ncv 18 -pep_target -50 -terse
       requires: !single
+      output_file: output/spring_2.out
       filter: sed -e "s/[+-]0\.0*i//g"
+      test:
+         suffix: 2
+      test:
+         suffix: 2_block
+         args: -pep_jd_blocksize 3
 
    test:
       suffix: 3
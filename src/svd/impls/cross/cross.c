@@ -14,18 +14,27 @@
 */
 
 #include <slepc/private/svdimpl.h>                /*I "slepcsvd.h" I*/
+#include <slepcblaslapack.h>
 
 typedef struct {
   PetscBool explicitmatrix;
+  PetscBool fused;
+  PetscBool usefused;       /* the fused kernel is available for the matrix type */
+  PetscBool sketch;         /* precondition A^T*A with the R factor of a sketch of A */
+  PetscInt  sketchsize;     /* number of rows of the sketch */
+  PetscBool defksp;         /* the KSP type of the internal EPS was not set by the user */
   EPS       eps;
   PetscBool usereps;
   Mat       C,D;
 } SVD_CROSS;
 
 typedef struct {
-  Mat       A,AT;
-  Vec       w,diag,omega;
-  PetscBool swapped;
+  Mat         A,AT;
+  Vec         w,diag,omega;
+  PetscBool   swapped;
+  PetscInt    lwork;         /* size of the work arrays of the fused product */
+  PetscScalar *xall,*yall,*t;
+  PetscMPIInt *counts,*displs;
 } SVD_CROSS_SHELL;
 
 static PetscErrorCode MatMult_Cross(Mat B,Vec x,Vec y)
@@ -40,6 +49,146 @@ static PetscErrorCode MatMult_Cross(Mat B,Vec x,Vec y)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   MatMultCross_AIJ - Computes y = A^H*A*x (or A^H*Omega*A*x) for k vectors stored
+   row-wise (entry j of vector l in position j*k+l), traversing the local rows of
+   A only once: each row contributes row_i^H*(row_i*x) to a full-length work array.
+   The short vector x is gathered in all processes, and the contributions are summed
+   and distributed with a single reduction
+*/
+static PetscErrorCode MatMultCross_AIJ(SVD_CROSS_SHELL *ctx,PetscInt k,const PetscScalar *x,PetscScalar *y)
+{
+  Mat               Ad,Ao=NULL;
+  MPI_Comm          comm;
+  PetscMPIInt       size,rank;
+  PetscInt          i,j,l,c,m,N,cstart,nz;
+  const PetscInt    *ranges,*ia,*ja,*ib=NULL,*jb=NULL,*garray=NULL;
+  const PetscScalar *va,*vb=NULL,*xa,*om=NULL;
+  PetscScalar       *ya,*t;
+  PetscBool         done,ismpi;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)ctx->A,&comm));
+  PetscCallMPI(MPI_Comm_size(comm,&size));
+  PetscCallMPI(MPI_Comm_rank(comm,&rank));
+  PetscCall(MatGetSize(ctx->A,NULL,&N));
+  PetscCall(MatGetOwnershipRangeColumn(ctx->A,&cstart,NULL));
+  if (ctx->lwork<N*k) {
+    PetscCall(PetscFree3(ctx->xall,ctx->yall,ctx->t));
+    PetscCall(PetscMalloc3(N*k,&ctx->xall,N*k,&ctx->yall,k,&ctx->t));
+    ctx->lwork = N*k;
+  }
+  t = ctx->t;
+
+  /* gather the whole vector x */
+  if (size>1) {
+    PetscCall(MatGetOwnershipRangesColumn(ctx->A,&ranges));
+    for (i=0;i<size;i++) {
+      PetscCall(PetscMPIIntCast(k*(ranges[i+1]-ranges[i]),&ctx->counts[i]));
+      PetscCall(PetscMPIIntCast(k*ranges[i],&ctx->displs[i]));
+    }
+    PetscCallMPI(MPI_Allgatherv(x,ctx->counts[rank],MPIU_SCALAR,ctx->xall,ctx->counts,ctx->displs,MPIU_SCALAR,comm));
+    xa = ctx->xall;
+    ya = ctx->yall;
+  } else {
+    xa = x;
+    ya = y;
+  }
+  PetscCall(PetscArrayzero(ya,N*k));
+
+  /* single pass over the local rows, with diagonal and off-diagonal blocks in parallel */
+  PetscCall(PetscObjectTypeCompare((PetscObject)ctx->A,MATMPIAIJ,&ismpi));
+  if (ismpi) PetscCall(MatMPIAIJGetSeqAIJ(ctx->A,&Ad,&Ao,&garray));
+  else Ad = ctx->A;
+  PetscCall(MatGetRowIJ(Ad,0,PETSC_FALSE,PETSC_FALSE,&m,&ia,&ja,&done));
+  PetscCheck(done,comm,PETSC_ERR_SUP,"Cannot get the local rows of the matrix");
+  PetscCall(MatSeqAIJGetArrayRead(Ad,&va));
+  if (Ao) {
+    PetscCall(MatGetRowIJ(Ao,0,PETSC_FALSE,PETSC_FALSE,&m,&ib,&jb,&done));
+    PetscCheck(done,comm,PETSC_ERR_SUP,"Cannot get the local rows of the matrix");
+    PetscCall(MatSeqAIJGetArrayRead(Ao,&vb));
+  }
+  if (ctx->omega && !ctx->swapped) PetscCall(VecGetArrayRead(ctx->omega,&om));
+  for (i=0;i<m;i++) {
+    for (l=0;l<k;l++) t[l] = 0.0;
+    for (j=ia[i];j<ia[i+1];j++) {
+      c = (cstart+ja[j])*k;
+      for (l=0;l<k;l++) t[l] += va[j]*xa[c+l];
+    }
+    if (Ao) {
+      for (j=ib[i];j<ib[i+1];j++) {
+        c = garray[jb[j]]*k;
+        for (l=0;l<k;l++) t[l] += vb[j]*xa[c+l];
+      }
+    }
+    if (om) for (l=0;l<k;l++) t[l] *= om[i];
+    for (j=ia[i];j<ia[i+1];j++) {
+      c = (cstart+ja[j])*k;
+      for (l=0;l<k;l++) ya[c+l] += PetscConj(va[j])*t[l];
+    }
+    if (Ao) {
+      for (j=ib[i];j<ib[i+1];j++) {
+        c = garray[jb[j]]*k;
+        for (l=0;l<k;l++) ya[c+l] += PetscConj(vb[j])*t[l];
+      }
+    }
+  }
+  nz = ia[m]+(Ao?ib[m]:0);
+  if (om) PetscCall(VecRestoreArrayRead(ctx->omega,&om));
+  PetscCall(MatSeqAIJRestoreArrayRead(Ad,&va));
+  PetscCall(MatRestoreRowIJ(Ad,0,PETSC_FALSE,PETSC_FALSE,&m,&ia,&ja,&done));
+  if (Ao) {
+    PetscCall(MatSeqAIJRestoreArrayRead(Ao,&vb));
+    PetscCall(MatRestoreRowIJ(Ao,0,PETSC_FALSE,PETSC_FALSE,&m,&ib,&jb,&done));
+  }
+  PetscCall(PetscLogFlops(4.0*k*nz));
+
+  /* sum the contributions and scatter the result */
+  if (size>1) PetscCallMPI(MPI_Reduce_scatter(ctx->yall,y,ctx->counts,MPIU_SCALAR,MPIU_SUM,comm));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatMult_Cross_AIJ(Mat B,Vec x,Vec y)
+{
+  SVD_CROSS_SHELL   *ctx;
+  const PetscScalar *px;
+  PetscScalar       *py;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(B,&ctx));
+  PetscCall(VecGetArrayRead(x,&px));
+  PetscCall(VecGetArrayWrite(y,&py));
+  PetscCall(MatMultCross_AIJ(ctx,1,px,py));
+  PetscCall(VecRestoreArrayRead(x,&px));
+  PetscCall(VecRestoreArrayWrite(y,&py));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode MatMatMult_Cross_AIJ(Mat B,Mat X,Mat Y,void *pctx)
+{
+  SVD_CROSS_SHELL   *ctx;
+  PetscInt          i,l,n,k,ldx,ldy;
+  const PetscScalar *px;
+  PetscScalar       *py,*xr,*yr;
+
+  PetscFunctionBegin;
+  PetscCall(MatShellGetContext(B,&ctx));
+  PetscCall(MatGetLocalSize(X,&n,NULL));
+  PetscCall(MatGetSize(X,NULL,&k));
+  PetscCall(MatDenseGetLDA(X,&ldx));
+  PetscCall(MatDenseGetLDA(Y,&ldy));
+  PetscCall(PetscMalloc2(n*k,&xr,n*k,&yr));
+  PetscCall(MatDenseGetArrayRead(X,&px));
+  for (l=0;l<k;l++) for (i=0;i<n;i++) xr[i*k+l] = px[i+l*ldx];
+  PetscCall(MatDenseRestoreArrayRead(X,&px));
+  PetscCall(MatMultCross_AIJ(ctx,k,xr,yr));
+  PetscCall(MatDenseGetArrayWrite(Y,&py));
+  for (l=0;l<k;l++) for (i=0;i<n;i++) py[i+l*ldy] = yr[i*k+l];
+  PetscCall(MatDenseRestoreArrayWrite(Y,&py));
+  PetscCall(PetscFree2(xr,yr));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode MatGetDiagonal_Cross(Mat B,Vec d)
 {
   SVD_CROSS_SHELL   *ctx;
@@ -92,6 +241,8 @@ static PetscErrorCode MatDestroy_Cross(Mat B)
   PetscCall(MatShellGetContext(B,&ctx));
   PetscCall(VecDestroy(&ctx->w));
   PetscCall(VecDestroy(&ctx->diag));
+  PetscCall(PetscFree3(ctx->xall,ctx->yall,ctx->t));
+  PetscCall(PetscFree2(ctx->counts,ctx->displs));
   PetscCall(PetscFree(ctx));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -101,8 +252,10 @@ static PetscErrorCode SVDCrossGetProductMat(SVD svd,Mat A,Mat AT,Mat *C)
   SVD_CROSS       *cross = (SVD_CROSS*)svd->data;
   SVD_CROSS_SHELL *ctx;
   PetscInt        n;
+  PetscMPIInt     size;
   VecType         vtype;
   Mat             B;
+  PetscBool       isaij=PETSC_FALSE;
 
   PetscFunctionBegin;
   if (cross->explicitmatrix) {
@@ -137,10 +290,19 @@ static PetscErrorCode SVDCrossGetProductMat(SVD svd,Mat A,Mat AT,Mat *C)
     ctx->AT      = AT;
     ctx->omega   = svd->omega;
     ctx->swapped = svd->swapped;
-    PetscCall(MatCreateVecs(A,NULL,&ctx->w));
+    if (cross->fused) PetscCall(PetscObjectTypeCompareAny((PetscObject)A,&isaij,MATSEQAIJ,MATMPIAIJ,""));
+    if (cross->fused && !isaij) PetscCall(PetscInfo(svd,"Fused product not available for this matrix type, using two matrix-vector products\n"));
+    cross->usefused = isaij;
+    if (isaij) {
+      PetscCallMPI(MPI_Comm_size(PetscObjectComm((PetscObject)A),&size));
+      PetscCall(PetscMalloc2(size,&ctx->counts,size,&ctx->displs));
+    } else PetscCall(MatCreateVecs(A,NULL,&ctx->w));
     PetscCall(MatGetLocalSize(A,NULL,&n));
     PetscCall(MatCreateShell(PetscObjectComm((PetscObject)svd),n,n,PETSC_DETERMINE,PETSC_DETERMINE,(void*)ctx,C));
-    PetscCall(MatShellSetOperation(*C,MATOP_MULT,(void(*)(void))MatMult_Cross));
+    if (isaij) {
+      PetscCall(MatShellSetOperation(*C,MATOP_MULT,(void(*)(void))MatMult_Cross_AIJ));
+      PetscCall(MatShellSetMatProductOperation(*C,MATPRODUCT_AB,NULL,MatMatMult_Cross_AIJ,NULL,MATDENSE,MATDENSE));
+    } else PetscCall(MatShellSetOperation(*C,MATOP_MULT,(void(*)(void))MatMult_Cross));
     if (!svd->ishyperbolic || svd->swapped) PetscCall(MatShellSetOperation(*C,MATOP_GET_DIAGONAL,(void(*)(void))MatGetDiagonal_Cross));
     PetscCall(MatShellSetOperation(*C,MATOP_DESTROY,(void(*)(void))MatDestroy_Cross));
     PetscCall(MatGetVecType(A,&vtype));
@@ -149,6 +311,205 @@ static PetscErrorCode SVDCrossGetProductMat(SVD svd,Mat A,Mat AT,Mat *C)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+typedef struct {
+  PetscInt    N;
+  PetscScalar *R;           /* upper triangular factor of the sketch, replicated in all processes */
+  PetscScalar *work;
+  VecScatter  scatter;
+  Vec         xall;
+} SVD_CROSS_SKETCH;
+
+/*
+   Hash of a global row index, used to select the row of the sketch and the sign
+   of the contribution, so that the sparse embedding does not depend on the
+   number of processes
+*/
+static inline PetscInt64 SVDCrossSketchHash(PetscInt64 x)
+{
+  unsigned long long z = (unsigned long long)x + 0x9e3779b97f4a7c15ULL;
+
+  z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+  z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+  return (PetscInt64)((z ^ (z >> 31)) >> 1);
+}
+
+/*
+   PCApply_CrossSketch - Applies y = R^{-1}*R^{-*}*x, where R is the triangular factor
+   of the QR factorization of the sketch S*A, so that (S*A)^*(S*A) = R^*R approximates A^*A
+*/
+static PetscErrorCode PCApply_CrossSketch(PC pc,Vec x,Vec y)
+{
+  SVD_CROSS_SKETCH  *ctx;
+  PetscInt          i,start,end;
+  PetscBLASInt      n,ld,one=1;
+  PetscScalar       sone=1.0,*py;
+  const PetscScalar *px;
+
+  PetscFunctionBegin;
+  PetscCall(PCShellGetContext(pc,&ctx));
+  PetscCall(VecScatterBegin(ctx->scatter,x,ctx->xall,INSERT_VALUES,SCATTER_FORWARD));
+  PetscCall(VecScatterEnd(ctx->scatter,x,ctx->xall,INSERT_VALUES,SCATTER_FORWARD));
+  PetscCall(VecGetArrayRead(ctx->xall,&px));
+  PetscCall(PetscArraycpy(ctx->work,px,ctx->N));
+  PetscCall(VecRestoreArrayRead(ctx->xall,&px));
+  PetscCall(PetscBLASIntCast(ctx->N,&n));
+  ld = n;
+  PetscCallBLAS("BLAStrsm",BLAStrsm_("L","U","C","N",&n,&one,&sone,ctx->R,&ld,ctx->work,&ld));
+  PetscCallBLAS("BLAStrsm",BLAStrsm_("L","U","N","N",&n,&one,&sone,ctx->R,&ld,ctx->work,&ld));
+  PetscCall(VecGetOwnershipRange(y,&start,&end));
+  PetscCall(VecGetArrayWrite(y,&py));
+  for (i=start;i<end;i++) py[i-start] = ctx->work[i];
+  PetscCall(VecRestoreArrayWrite(y,&py));
+  PetscCall(PetscLogFlops(2.0*n*n));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode PCDestroy_CrossSketch(PC pc)
+{
+  SVD_CROSS_SKETCH *ctx;
+
+  PetscFunctionBegin;
+  PetscCall(PCShellGetContext(pc,&ctx));
+  PetscCall(PetscFree2(ctx->R,ctx->work));
+  PetscCall(VecScatterDestroy(&ctx->scatter));
+  PetscCall(VecDestroy(&ctx->xall));
+  PetscCall(PetscFree(ctx));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SVDCrossSetUpSketch - Computes a sparse embedding S*A of the rows of A (each row
+   is added with a random sign to a row of the sketch selected at random), the QR
+   factorization S*A = Q*R, and sets R^{-1}*R^{-*} as the preconditioner of the
+   linear solves with A^*A in shift-and-invert with zero shift
+*/
+static PetscErrorCode SVDCrossSetUpSketch(SVD svd,ST st)
+{
+  SVD_CROSS         *cross = (SVD_CROSS*)svd->data;
+  SVD_CROSS_SKETCH  *ctx;
+  KSP               ksp;
+  PC                pc;
+  Vec               x;
+  PetscInt          i,j,r,M,N,s,start,end,ncols,lwork;
+  PetscInt64        h;
+  PetscMPIInt       len;
+  PetscBLASInt      m_,n_,ld_,lw_,info;
+  PetscScalar       *SA,*lSA,*tau,*work,sgn,dummy;
+  const PetscInt    *cols;
+  const PetscScalar *vals;
+  PetscBool         flg,full;
+  const char        *name;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(svd->A,&M,&N));
+  PetscCall(MatHasOperation(svd->A,MATOP_GET_ROW,&flg));
+  PetscCheck(flg,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The sketch needs access to the rows of the matrix, try with an explicit transpose");
+  s = cross->sketchsize;
+  if (s==PETSC_DETERMINE) s = 4*N;
+  PetscCheck(s>=N,PetscObjectComm((PetscObject)svd),PETSC_ERR_USER_INPUT,"The sketch size must be at least the number of columns %" PetscInt_FMT,N);
+  full = (s>=M)? PETSC_TRUE: PETSC_FALSE;  /* no compression possible, take the rows of A */
+  if (full) s = M;
+  PetscCall(PetscInfo(svd,"Computing a sketch of size %" PetscInt_FMT "x%" PetscInt_FMT "\n",s,N));
+
+  /* sketch S*A, stored by columns, added up from the local rows */
+  PetscCall(PetscMPIIntCast(s*N,&len));
+  PetscCall(PetscCalloc2(s*N,&lSA,s*N,&SA));
+  PetscCall(MatGetOwnershipRange(svd->A,&start,&end));
+  for (i=start;i<end;i++) {
+    if (full) {
+      sgn = 1.0;
+      r   = i;
+    } else {
+      h   = SVDCrossSketchHash(i);
+      sgn = (h&1)? -1.0: 1.0;
+      r   = (PetscInt)((h>>1)%s);
+    }
+    PetscCall(MatGetRow(svd->A,i,&ncols,&cols,&vals));
+    for (j=0;j<ncols;j++) lSA[r+cols[j]*s] += sgn*vals[j];
+    PetscCall(MatRestoreRow(svd->A,i,&ncols,&cols,&vals));
+  }
+  PetscCallMPI(MPIU_Allreduce(lSA,SA,len,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)svd)));
+
+  /* QR factorization, computed redundantly in all processes */
+  PetscCall(PetscBLASIntCast(s,&m_));
+  PetscCall(PetscBLASIntCast(N,&n_));
+  ld_ = m_;
+  lw_ = -1;
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&m_,&n_,SA,&ld_,&dummy,&dummy,&lw_,&info));
+  SlepcCheckLapackInfo("geqrf",info);
+  lwork = (PetscInt)PetscRealPart(dummy);
+  PetscCall(PetscBLASIntCast(lwork,&lw_));
+  PetscCall(PetscMalloc2(N,&tau,lwork,&work));
+  PetscCallBLAS("LAPACKgeqrf",LAPACKgeqrf_(&m_,&n_,SA,&ld_,tau,work,&lw_,&info));
+  PetscCall(PetscFPTrapPop());
+  SlepcCheckLapackInfo("geqrf",info);
+  PetscCall(PetscFree2(tau,work));
+
+  PetscCall(PetscNew(&ctx));
+  ctx->N = N;
+  PetscCall(PetscCalloc2(N*N,&ctx->R,N,&ctx->work));
+  for (j=0;j<N;j++) {
+    for (i=0;i<=j;i++) ctx->R[i+j*N] = SA[i+j*s];
+    PetscCheck(ctx->R[j+j*N]!=0.0,PetscObjectComm((PetscObject)svd),PETSC_ERR_CONV_FAILED,"The sketch is rank deficient, try a larger sketch size");
+  }
+  PetscCall(PetscFree2(lSA,SA));
+  PetscCall(MatCreateVecs(svd->A,&x,NULL));
+  PetscCall(VecScatterCreateToAll(x,&ctx->scatter,&ctx->xall));
+  PetscCall(VecDestroy(&x));
+
+  /* precondition the inner solver with R^{-1}*R^{-*} */
+  PetscCall(STGetKSP(st,&ksp));
+  PetscCall(KSPGetPC(ksp,&pc));
+  PetscCall(PetscObjectTypeCompare((PetscObject)pc,PCSHELL,&flg));
+  if (flg) {  /* discard the sketch from a previous setup */
+    PetscCall(PCShellGetName(pc,&name));
+    PetscCall(PetscStrcmp(name,"sketch",&flg));
+    if (flg) PetscCall(PCSetType(pc,PCNONE));
+  }
+  PetscCall(PCSetType(pc,PCSHELL));
+  PetscCall(PCShellSetContext(pc,ctx));
+  PetscCall(PCShellSetApply(pc,PCApply_CrossSketch));
+  PetscCall(PCShellSetDestroy(pc,PCDestroy_CrossSketch));
+  PetscCall(PCShellSetName(pc,"sketch"));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   SVDCrossSetDefaultSketchST - Sets the defaults for the sketch preconditioner in the
+   ST of the internal EPS: shift-and-invert instead of the default STSHIFT, and CG with
+   a tolerance below the one of the SVD unless the KSP type has been set by the user. A
+   type chosen by STSetFromOptions() while computing the largest singular values is not
+   a user setting, see SVDSetFromOptions_Cross(). Nothing is changed if the user has
+   provided the EPS with SVDCrossSetEPS()
+*/
+static PetscErrorCode SVDCrossSetDefaultSketchST(SVD svd)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+  ST        st;
+  KSP       ksp;
+  KSPType   ksptype;
+  PetscReal tol;
+  PetscBool isshift;
+
+  PetscFunctionBegin;
+  if (!cross->sketch || cross->usereps || svd->which==SVD_LARGEST) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(EPSGetST(cross->eps,&st));
+  PetscCall(PetscObjectTypeCompare((PetscObject)st,STSHIFT,&isshift));
+  if (!isshift && ((PetscObject)st)->type_name) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(STSetType(st,STSINVERT));
+  PetscCall(STGetKSP(st,&ksp));
+  PetscCall(KSPGetType(ksp,&ksptype));
+  if (!ksptype || cross->defksp) {
+    PetscCall(KSPSetType(ksp,KSPCG));
+    tol = (svd->tol==(PetscReal)PETSC_DETERMINE)? SLEPC_DEFAULT_TOL: svd->tol;
+    PetscCall(KSPSetTolerances(ksp,PetscMax(tol/100.0,10*PETSC_MACHINE_EPSILON),PETSC_CURRENT,PETSC_CURRENT,PETSC_CURRENT));
+  }
+  /* STSHIFT does not process the KSP options, so do it here */
+  if (isshift) PetscCall(KSPSetFromOptions(ksp));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /* Convergence test relative to the norm of R (used in GSVD only) */
 static PetscErrorCode EPSConv_Cross(EPS eps,PetscScalar eigr,PetscScalar eigi,PetscReal res,PetscReal *errest,void *ctx)
 {
@@ -196,6 +557,16 @@ static PetscErrorCode SVDSetUp_Cross(SVD svd)
     PetscCall(EPSSetOperators(cross->eps,cross->C,NULL));
     PetscCall(EPSSetProblemType(cross->eps,EPS_HEP));
   }
+  if (cross->sketch && svd->which==SVD_LARGEST) PetscCall(PetscInfo(svd,"The sketch preconditioner is ignored when computing the largest singular values\n"));
+  else if (cross->sketch) {  /* shift-and-invert, preconditioned with a sketch */
+    SVDCheckStandardCondition(svd,PETSC_TRUE," with the sketch preconditioner");
+    SVDCheckDefiniteCondition(svd,PETSC_TRUE," with the sketch preconditioner");
+    PetscCall(SVDCrossSetDefaultSketchST(svd));
+    PetscCall(EPSGetST(cross->eps,&st));
+    PetscCall(PetscObjectTypeCompare((PetscObject)st,STSINVERT,&issinv));
+    PetscCheck(issinv,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The sketch preconditioner requires an ST of type STSINVERT in the internal EPS");
+    PetscCall(SVDCrossSetUpSketch(svd,st));
+  }
   if (!cross->usereps) {
     PetscCall(EPSGetST(cross->eps,&st));
     PetscCall(PetscObjectTypeCompare((PetscObject)st,STSINVERT,&issinv));
@@ -385,9 +756,13 @@ static PetscErrorCode EPSMonitor_Cross(EPS eps,PetscInt its,PetscInt nconv,Petsc
 
 static PetscErrorCode SVDSetFromOptions_Cross(SVD svd,PetscOptionItems *PetscOptionsObject)
 {
-  PetscBool      set,val;
+  PetscBool      set,set2,val;
+  PetscInt       k;
   SVD_CROSS      *cross = (SVD_CROSS*)svd->data;
   ST             st;
+  KSP            ksp;
+  KSPType        ksptype;
+  const char     *prefix;
 
   PetscFunctionBegin;
   PetscOptionsHeadBegin(PetscOptionsObject,"SVD Cross Options");
@@ -395,6 +770,14 @@ static PetscErrorCode SVDSetFromOptions_Cross(SVD svd,PetscOptionItems *PetscOpt
     PetscCall(PetscOptionsBool("-svd_cross_explicitmatrix","Use cross explicit matrix","SVDCrossSetExplicitMatrix",cross->explicitmatrix,&val,&set));
     if (set) PetscCall(SVDCrossSetExplicitMatrix(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_cross_fused_product","Use a fused kernel for the implicit cross product matrix","SVDCrossSetFusedProduct",cross->fused,&val,&set));
+    if (set) PetscCall(SVDCrossSetFusedProduct(svd,val));
+
+    PetscCall(PetscOptionsBool("-svd_cross_sketch","Precondition with the triangular factor of a sketch of the matrix","SVDCrossSetSketch",cross->sketch,&val,&set));
+    k = cross->sketchsize;
+    PetscCall(PetscOptionsInt("-svd_cross_sketch_size","Number of rows of the sketch","SVDCrossSetSketch",cross->sketchsize,&k,&set2));
+    if (set || set2) PetscCall(SVDCrossSetSketch(svd,set?val:cross->sketch,k));
+
   PetscOptionsHeadEnd();
 
   if (!cross->eps) PetscCall(SVDCrossGetEPS(svd,&cross->eps));
@@ -403,6 +786,16 @@ static PetscErrorCode SVDSetFromOptions_Cross(SVD svd,PetscOptionItems *PetscOpt
     PetscCall(EPSGetST(cross->eps,&st));
     PetscCall(STSetMatMode(st,ST_MATMODE_SHELL));
   }
+  if (cross->sketch && !cross->usereps) {
+    /* a KSP type set after this point comes from the defaults of STSetFromOptions() */
+    PetscCall(EPSGetST(cross->eps,&st));
+    PetscCall(STGetKSP(st,&ksp));
+    PetscCall(KSPGetType(ksp,&ksptype));
+    PetscCall(KSPGetOptionsPrefix(ksp,&prefix));
+    PetscCall(PetscOptionsHasName(((PetscObject)ksp)->options,prefix,"-ksp_type",&set));
+    cross->defksp = (!set && (!ksptype || cross->defksp))? PETSC_TRUE: PETSC_FALSE;
+  }
+  PetscCall(SVDCrossSetDefaultSketchST(svd));
   PetscCall(EPSSetFromOptions(cross->eps));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -478,6 +871,197 @@ PetscErrorCode SVDCrossGetExplicitMatrix(SVD svd,PetscBool *explicitmat)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDCrossSetFusedProduct_Cross(SVD svd,PetscBool fused)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  if (cross->fused != fused) {
+    cross->fused = fused;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossSetFusedProduct - Indicate if the implicit operator A^T*A must be
+   applied with a fused kernel that traverses the rows of A only once.
+
+   Logically Collective
+
+   Input Parameters:
++  svd   - singular value solver
+-  fused - boolean flag indicating if the fused kernel is used
+
+   Options Database Key:
+.  -svd_cross_fused_product <boolean> - Indicates the boolean flag
+
+   Notes:
+   By default, the implicit cross product matrix is applied as two matrix-vector
+   products, with an intermediate vector of the size of the number of rows of A.
+   With the fused kernel, each local row of A contributes row_i^T*(row_i*x) to
+   the result directly, so the matrix is read once per application and neither
+   the intermediate vector nor the transpose of A are used. Products with several
+   vectors, such as those issued by BVMatMult(), are computed in a single pass too.
+
+   The fused kernel is available for MATSEQAIJ and MATMPIAIJ matrices, and it is
+   ignored otherwise. In parallel, each process stores vectors of length equal
+   to the number of columns of A and the result is assembled with one reduction,
+   so it is intended for tall-skinny matrices. Since the transpose is no longer
+   needed, combine it with SVDSetImplicitTranspose() to avoid building A^T.
+
+   It has no effect if SVDCrossSetExplicitMatrix() has been set.
+
+   Level: advanced
+
+.seealso: SVDCrossGetFusedProduct(), SVDCrossSetExplicitMatrix(), SVDSetImplicitTranspose()
+@*/
+PetscErrorCode SVDCrossSetFusedProduct(SVD svd,PetscBool fused)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,fused,2);
+  PetscTryMethod(svd,"SVDCrossSetFusedProduct_C",(SVD,PetscBool),(svd,fused));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDCrossGetFusedProduct_Cross(SVD svd,PetscBool *fused)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  *fused = cross->fused;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossGetFusedProduct - Returns the flag indicating if the implicit operator
+   A^T*A is applied with a fused kernel.
+
+   Not Collective
+
+   Input Parameter:
+.  svd  - singular value solver
+
+   Output Parameter:
+.  fused - the flag
+
+   Level: advanced
+
+.seealso: SVDCrossSetFusedProduct()
+@*/
+PetscErrorCode SVDCrossGetFusedProduct(SVD svd,PetscBool *fused)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(fused,2);
+  PetscUseMethod(svd,"SVDCrossGetFusedProduct_C",(SVD,PetscBool*),(svd,fused));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDCrossSetSketch_Cross(SVD svd,PetscBool sketch,PetscInt size)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  if (size==PETSC_DETERMINE || size==PETSC_DECIDE) size = PETSC_DETERMINE;
+  else if (size!=PETSC_CURRENT) PetscCheck(size>0,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of size. Must be > 0");
+  if (cross->sketch != sketch || (size!=PETSC_CURRENT && cross->sketchsize != size)) {
+    cross->sketch = sketch;
+    if (size!=PETSC_CURRENT) cross->sketchsize = size;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossSetSketch - Indicate if the computation of the smallest singular values
+   must be accelerated with a preconditioner obtained from a sketch of the matrix.
+
+   Logically Collective
+
+   Input Parameters:
++  svd    - singular value solver
+.  sketch - boolean flag indicating if the sketch preconditioner is used
+-  size   - number of rows of the sketch
+
+   Options Database Keys:
++  -svd_cross_sketch <boolean> - Indicates the boolean flag
+-  -svd_cross_sketch_size <size> - Sets the number of rows of the sketch
+
+   Notes:
+   This is intended for the smallest singular values of tall sparse matrices,
+   where the eigensolver on A^*A converges slowly unless shift-and-invert is used,
+   but a factorization of A^*A is too expensive. When the flag is set, the rows of
+   A are combined into a sketch S*A with a sparse embedding, i.e., each row is added
+   with a random sign to a random row of the sketch, and the QR factorization
+   S*A = Q*R is computed. Then the eigensolver uses shift-and-invert with zero shift,
+   with the linear systems solved by CG preconditioned with R^{-1}*R^{-*}. Since
+   A*R^{-1} is well conditioned, CG needs few iterations. The computed singular
+   values are those of A, the preconditioner affects only the linear solves.
+
+   Shift-and-invert replaces the default ST, and CG is used unless another KSP type
+   has been set, e.g., with -svd_cross_st_ksp_type. These defaults are not applied if
+   the EPS has been provided with SVDCrossSetEPS(). In any case, the ST must be of type
+   STSINVERT, and the preconditioner of its KSP is replaced by the sketch.
+
+   The sketch and R are dense matrices replicated in all processes, of sizes
+   size x N and N x N, respectively, where N is the number of columns of A, so it
+   is intended for a moderate N. Use PETSC_DETERMINE for size to select the
+   default, 4*N, or PETSC_CURRENT to keep the current value. If size is not
+   smaller than the number of rows M, then the rows of A are used directly.
+
+   The flag has no effect when computing the largest singular values.
+
+   Level: advanced
+
+.seealso: SVDCrossGetSketch(), SVDSetWhichSingularTriplets()
+@*/
+PetscErrorCode SVDCrossSetSketch(SVD svd,PetscBool sketch,PetscInt size)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,sketch,2);
+  PetscValidLogicalCollectiveInt(svd,size,3);
+  PetscTryMethod(svd,"SVDCrossSetSketch_C",(SVD,PetscBool,PetscInt),(svd,sketch,size));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDCrossGetSketch_Cross(SVD svd,PetscBool *sketch,PetscInt *size)
+{
+  SVD_CROSS *cross = (SVD_CROSS*)svd->data;
+
+  PetscFunctionBegin;
+  if (sketch) *sketch = cross->sketch;
+  if (size) *size = cross->sketchsize;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCrossGetSketch - Returns the flag indicating if the sketch preconditioner
+   is used, and the number of rows of the sketch.
+
+   Not Collective
+
+   Input Parameter:
+.  svd  - singular value solver
+
+   Output Parameters:
++  sketch - the flag
+-  size   - number of rows of the sketch
+
+   Level: advanced
+
+.seealso: SVDCrossSetSketch()
+@*/
+PetscErrorCode SVDCrossGetSketch(SVD svd,PetscBool *sketch,PetscInt *size)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscUseMethod(svd,"SVDCrossGetSketch_C",(SVD,PetscBool*,PetscInt*),(svd,sketch,size));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDCrossSetEPS_Cross(SVD svd,EPS eps)
 {
   SVD_CROSS      *cross = (SVD_CROSS*)svd->data;
@@ -568,6 +1152,14 @@ static PetscErrorCode SVDView_Cross(SVD svd,PetscViewer viewer)
   if (isascii) {
     if (!cross->eps) PetscCall(SVDCrossGetEPS(svd,&cross->eps));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix\n",cross->explicitmatrix?"explicit":"implicit"));
+    if (!cross->explicitmatrix && cross->fused) {
+      if (svd->state>=SVD_STATE_SETUP && !cross->usefused) PetscCall(PetscViewerASCIIPrintf(viewer,"  fused kernel for the cross product not available for this matrix type\n"));
+      else PetscCall(PetscViewerASCIIPrintf(viewer,"  using a fused kernel for the cross product (AIJ matrices)\n"));
+    }
+    if (cross->sketch) {
+      if (cross->sketchsize==PETSC_DETERMINE) PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioned with a sketch of the matrix\n"));
+      else PetscCall(PetscViewerASCIIPrintf(viewer,"  preconditioned with a sketch of %" PetscInt_FMT " rows\n",cross->sketchsize));
+    }
     PetscCall(PetscViewerASCIIPushTab(viewer));
     PetscCall(EPSView(cross->eps,viewer));
     PetscCall(PetscViewerASCIIPopTab(viewer));
@@ -597,6 +1189,10 @@ static PetscErrorCode SVDDestroy_Cross(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetEPS_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetExplicitMatrix_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetExplicitMatrix_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetFusedProduct_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetFusedProduct_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetSketch_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetSketch_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -607,6 +1203,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_Cross(SVD svd)
   PetscFunctionBegin;
   PetscCall(PetscNew(&cross));
   svd->data = (void*)cross;
+  cross->sketchsize = PETSC_DETERMINE;
 
   svd->ops->solve          = SVDSolve_Cross;
   svd->ops->solveg         = SVDSolve_Cross;
@@ -621,5 +1218,9 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_Cross(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetEPS_C",SVDCrossGetEPS_Cross));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetExplicitMatrix_C",SVDCrossSetExplicitMatrix_Cross));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetExplicitMatrix_C",SVDCrossGetExplicitMatrix_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetFusedProduct_C",SVDCrossSetFusedProduct_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetFusedProduct_C",SVDCrossGetFusedProduct_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossSetSketch_C",SVDCrossSetSketch_Cross));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCrossGetSketch_C",SVDCrossGetSketch_Cross));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
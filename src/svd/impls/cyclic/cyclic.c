@@ -381,9 +381,26 @@ static PetscErrorCode SVDSetUp_Cyclic(SVD svd)
   if (svd->nsv==0) svd->nsv = 1;
   PetscCall(MatGetSize(svd->A,&M,&N));
   PetscCall(MatGetLocalSize(svd->A,&m,&n));
-  if (!cyclic->eps) PetscCall(SVDCyclicGetEPS(svd,&cyclic->eps));
   PetscCall(MatDestroy(&cyclic->C));
   PetscCall(MatDestroy(&cyclic->D));
+  if (cyclic->structured) {  /* H(A) is not built, the eigensolver is not used */
+    SVDCheckStandardCondition(svd,PETSC_TRUE," with the structured variant");
+    SVDCheckDefiniteCondition(svd,PETSC_TRUE," with the structured variant");
+    PetscCheck(svd->which==SVD_LARGEST,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The structured variant only computes the largest singular values");
+    PetscCheck(!cyclic->usereps,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The structured variant does not use the EPS object");
+    PetscCheck(svd->stop!=SVD_STOP_THRESHOLD,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The threshold stopping test is not supported in the structured variant");
+    PetscCall(SVDSetDimensions_Default(svd));
+    PetscCheck(svd->ncv<=svd->nsv+svd->mpd,PetscObjectComm((PetscObject)svd),PETSC_ERR_USER_INPUT,"The value of ncv must not be larger than nsv+mpd");
+    if (svd->max_it==PETSC_DETERMINE) svd->max_it = PetscMax(N/svd->ncv,100);
+    svd->leftbasis = PETSC_TRUE;
+    PetscCall(SVDAllocateSolution(svd,1));
+    PetscCall(DSSetType(svd->ds,DSSVD));
+    PetscCall(DSSetCompact(svd->ds,PETSC_TRUE));
+    PetscCall(DSSetExtraRow(svd->ds,PETSC_TRUE));
+    PetscCall(DSAllocate(svd->ds,svd->ncv+1));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  if (!cyclic->eps) PetscCall(SVDCyclicGetEPS(svd,&cyclic->eps));
   if (svd->isgeneralized) {
     if (svd->which==SVD_SMALLEST) {  /* alternative pencil */
       PetscCall(MatCreateVecs(svd->B,NULL,&t));
@@ -544,6 +561,13 @@ static PetscErrorCode SVDSolve_Cyclic(SVD svd)
   PetscReal      sigma;
 
   PetscFunctionBegin;
+  if (cyclic->structured) {
+    /* started from [0;v], the Lanczos vectors of H(A) alternate between [0;v_j] and [u_j;0],
+       and the tridiagonal with zero diagonal is the Golub-Kahan bidiagonal, so the Lanczos
+       recurrence of H(A) is the bidiagonalization of A on the nonzero halves */
+    PetscCall(SVDThickRestartLanczos(svd,PETSC_FALSE,0.5,PETSC_TRUE));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(EPSSolve(cyclic->eps));
   PetscCall(EPSGetConverged(cyclic->eps,&nconv));
   PetscCall(EPSGetIterationNumber(cyclic->eps,&svd->its));
@@ -806,7 +830,10 @@ static PetscErrorCode SVDComputeVectors_Cyclic_Hyperbolic(SVD svd)
 
 static PetscErrorCode SVDComputeVectors_Cyclic(SVD svd)
 {
+  SVD_CYCLIC *cyclic = (SVD_CYCLIC*)svd->data;
+
   PetscFunctionBegin;
+  if (cyclic->structured) PetscFunctionReturn(PETSC_SUCCESS);  /* vectors are already in U and V */
   switch (svd->problem_type) {
     case SVD_STANDARD:
       PetscCall(SVDComputeVectors_Cyclic_Standard(svd));
@@ -862,6 +889,9 @@ static PetscErrorCode SVDSetFromOptions_Cyclic(SVD svd,PetscOptionItems *PetscOp
     PetscCall(PetscOptionsBool("-svd_cyclic_explicitmatrix","Use cyclic explicit matrix","SVDCyclicSetExplicitMatrix",cyclic->explicitmatrix,&val,&set));
     if (set) PetscCall(SVDCyclicSetExplicitMatrix(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_cyclic_structured","Exploit the structure of the cyclic matrix without building it","SVDCyclicSetStructured",cyclic->structured,&val,&set));
+    if (set) PetscCall(SVDCyclicSetStructured(svd,val));
+
   PetscOptionsHeadEnd();
 
   if (!cyclic->eps) PetscCall(SVDCyclicGetEPS(svd,&cyclic->eps));
@@ -945,6 +975,91 @@ PetscErrorCode SVDCyclicGetExplicitMatrix(SVD svd,PetscBool *explicitmat)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDCyclicSetStructured_Cyclic(SVD svd,PetscBool structured)
+{
+  SVD_CYCLIC *cyclic = (SVD_CYCLIC*)svd->data;
+
+  PetscFunctionBegin;
+  if (cyclic->structured != structured) {
+    cyclic->structured = structured;
+    svd->state = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCyclicSetStructured - Indicate if the structure of the cyclic matrix
+   H(A) = [ 0  A ; A^T 0 ] must be exploited, without building it.
+
+   Logically Collective
+
+   Input Parameters:
++  svd        - singular value solver
+-  structured - boolean flag indicating if the structured variant is used
+
+   Options Database Key:
+.  -svd_cyclic_structured <boolean> - Indicates the boolean flag
+
+   Notes:
+   In the structured variant, the Lanczos recurrence of H(A) is run starting from
+   a vector with zero top block. Then the Lanczos vectors have alternately zero top
+   and bottom blocks, so only the nonzero halves are stored, in the bases of right
+   and left singular vectors, respectively. This halves the memory of the basis with
+   respect to the eigensolver on H(A), and neither H(A) nor vectors of length m+n are
+   created, so the value of SVDCyclicSetExplicitMatrix() is irrelevant. The restart
+   is done with the SVD of the bidiagonal matrix that results from removing the
+   zero diagonal of the tridiagonal.
+
+   The eigensolver object is not used, and the structured variant is only available
+   for standard problems when computing the largest singular values.
+
+   Level: advanced
+
+.seealso: SVDCyclicGetStructured(), SVDCyclicSetExplicitMatrix()
+@*/
+PetscErrorCode SVDCyclicSetStructured(SVD svd,PetscBool structured)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,structured,2);
+  PetscTryMethod(svd,"SVDCyclicSetStructured_C",(SVD,PetscBool),(svd,structured));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDCyclicGetStructured_Cyclic(SVD svd,PetscBool *structured)
+{
+  SVD_CYCLIC *cyclic = (SVD_CYCLIC*)svd->data;
+
+  PetscFunctionBegin;
+  *structured = cyclic->structured;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDCyclicGetStructured - Returns the flag indicating if the structure of H(A)
+   is exploited.
+
+   Not Collective
+
+   Input Parameter:
+.  svd  - singular value solver
+
+   Output Parameter:
+.  structured - the flag
+
+   Level: advanced
+
+.seealso: SVDCyclicSetStructured()
+@*/
+PetscErrorCode SVDCyclicGetStructured(SVD svd,PetscBool *structured)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(structured,2);
+  PetscUseMethod(svd,"SVDCyclicGetStructured_C",(SVD,PetscBool*),(svd,structured));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDCyclicSetEPS_Cyclic(SVD svd,EPS eps)
 {
   SVD_CYCLIC      *cyclic = (SVD_CYCLIC*)svd->data;
@@ -1033,6 +1148,10 @@ static PetscErrorCode SVDView_Cyclic(SVD svd,PetscViewer viewer)
   PetscFunctionBegin;
   PetscCall(PetscObjectTypeCompare((PetscObject)viewer,PETSCVIEWERASCII,&isascii));
   if (isascii) {
+    if (cyclic->structured) {
+      PetscCall(PetscViewerASCIIPrintf(viewer,"  structured variant, Lanczos recurrence without building the cyclic matrix\n"));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
     if (!cyclic->eps) PetscCall(SVDCyclicGetEPS(svd,&cyclic->eps));
     PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix\n",cyclic->explicitmatrix?"explicit":"implicit"));
     PetscCall(PetscViewerASCIIPushTab(viewer));
@@ -1064,6 +1183,8 @@ static PetscErrorCode SVDDestroy_Cyclic(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetEPS_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicSetExplicitMatrix_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetExplicitMatrix_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicSetStructured_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetStructured_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1087,5 +1208,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_Cyclic(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetEPS_C",SVDCyclicGetEPS_Cyclic));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicSetExplicitMatrix_C",SVDCyclicSetExplicitMatrix_Cyclic));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetExplicitMatrix_C",SVDCyclicGetExplicitMatrix_Cyclic));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicSetStructured_C",SVDCyclicSetStructured_Cyclic));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDCyclicGetStructured_C",SVDCyclicGetStructured_Cyclic));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
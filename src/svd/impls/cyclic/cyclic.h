@@ -12,6 +12,7 @@
 
 typedef struct {
   PetscBool explicitmatrix;
+  PetscBool structured;     /* exploit the structure of H(A) without building it */
   EPS       eps;
   PetscBool usereps;
   Mat       C,D;
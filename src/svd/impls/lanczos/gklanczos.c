@@ -298,7 +298,7 @@ static PetscErrorCode SVDSolve_Lanczos(SVD svd)
 
     if (svd->reason == SVD_CONVERGED_ITERATING) {
       PetscCall(BVCopyColumn(svd->V,nv,k));  /* copy restart vector from the last column */
-      if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+      if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
         svd->ncv = svd->mpd+k;
         PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
         for (i=nv;i<svd->ncv;i++) svd->perm[i] = i;
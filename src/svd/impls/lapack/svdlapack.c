@@ -12,11 +12,18 @@
 */
 
 #include <slepc/private/svdimpl.h>
+#include <slepc/private/dsimpl.h>
 #include <slepcblaslapack.h>
 
+typedef struct {
+  PetscBool distributed;   /* reduce to bidiagonal form in parallel */
+} SVD_LAPACK;
+
 static PetscErrorCode SVDSetUp_LAPACK(SVD svd)
 {
+  SVD_LAPACK     *ctx = (SVD_LAPACK*)svd->data;
   PetscInt       M,N,P=0;
+  DSParallelType pmode;
 
   PetscFunctionBegin;
   if (svd->nsv==0) svd->nsv = 1;
@@ -30,19 +37,86 @@ static PetscErrorCode SVDSetUp_LAPACK(SVD svd)
   SVDCheckIgnored(svd,SVD_FEATURE_STOPPING);
   if (svd->max_it==PETSC_DETERMINE) svd->max_it = 1;
   svd->leftbasis = PETSC_TRUE;
+
+  /* distributed mode: the matrix is reduced to bidiagonal form in parallel in SVDSolve(),
+     and only the nsv wanted singular vectors are computed, so the DS is not used */
+  PetscCall(DSGetParallel(svd->ds,&pmode));
+  ctx->distributed = PETSC_FALSE;
+  if (pmode==DS_PARALLEL_DISTRIBUTED) {
+    if (!svd->isgeneralized && !svd->ishyperbolic) {
+      ctx->distributed = PETSC_TRUE;
+      svd->ncv = svd->nsv;
+      PetscCall(SVDAllocateSolution(svd,0));
+      PetscFunctionReturn(PETSC_SUCCESS);
+    }
+    PetscCall(PetscInfo(svd,"The distributed mode is available only for the standard SVD, using the redundant mode\n"));
+  }
   PetscCall(SVDAllocateSolution(svd,0));
   PetscCall(DSAllocate(svd->ds,PetscMax(N,PetscMax(M,P))));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   Distributed mode: all processes take part in the reduction to bidiagonal form
+   of a MATMPIDENSE copy of the (tall) matrix, the wanted singular vectors of the
+   bidiagonal are computed redundantly, and then each process obtains its rows of
+   the singular vectors by applying the Householder reflectors
+*/
+static PetscErrorCode SVDSolve_LAPACK_Distributed(SVD svd)
+{
+  PetscInt       M,N,nsv=svd->nsv,ldu,ldv,ncu,ncv,lowu,highu,lowv,highv;
+  Mat            Ad,At;
+  PetscScalar    *tauq,*taup,*G,*pU,*pV;
+  PetscReal      *d,*e;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(svd->OP,&M,&N));
+  PetscCall(MatConvert(svd->OP,MATDENSE,MAT_INITIAL_MATRIX,&Ad));
+  if (M<N) {
+    PetscCall(MatHermitianTranspose(Ad,MAT_INITIAL_MATRIX,&At));
+    PetscCall(MatDestroy(&Ad));
+    Ad = At;
+  }
+  PetscCall(MatGetSize(Ad,&M,&N));
+  PetscCall(MatGetOwnershipRange(Ad,&lowu,&highu));
+  PetscCall(MatGetOwnershipRangeColumn(Ad,&lowv,&highv));
+  PetscCall(PetscMalloc5(N,&d,N,&e,N,&tauq,N,&taup,PetscMax(highv-lowv,1)*N,&G));
+  PetscCall(DSReduceDistributed_SVD(Ad,d,e,tauq,taup,G));
+
+  /* local rows of the wanted singular vectors, in the order of svd->sigma */
+  PetscCall(BVGetNumConstraints(svd->U,&ncu));
+  PetscCall(BVGetNumConstraints(svd->V,&ncv));
+  PetscCall(BVGetLeadingDimension(svd->U,&ldu));
+  PetscCall(BVGetLeadingDimension(svd->V,&ldv));
+  PetscCall(BVGetArray(svd->U,&pU));
+  PetscCall(BVGetArray(svd->V,&pV));
+  PetscCall(DSSolveDistributed_SVD(N,d,e,PetscNot(svd->which==SVD_SMALLEST),nsv,svd->sigma,lowu,highu,pU+ncu*ldu,ldu,lowv,highv,pV+ncv*ldv,ldv));
+  PetscCall(DSBackTransformDistributed_SVD(Ad,tauq,taup,G,nsv,pU+ncu*ldu,ldu,pV+ncv*ldv,ldv));
+  PetscCall(BVRestoreArray(svd->U,&pU));
+  PetscCall(BVRestoreArray(svd->V,&pV));
+
+  svd->nconv  = nsv;
+  svd->its    = 1;
+  svd->reason = SVD_CONVERGED_TOL;
+
+  PetscCall(PetscFree5(d,e,tauq,taup,G));
+  PetscCall(MatDestroy(&Ad));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDSolve_LAPACK(SVD svd)
 {
+  SVD_LAPACK        *ctx = (SVD_LAPACK*)svd->data;
   PetscInt          M,N,n,i,j,k,ld,lowu,lowv,highu,highv;
   Mat               A,Ar,mat;
   Vec               u,v;
   PetscScalar       *pU,*pV,*pu,*pv,*w;
 
   PetscFunctionBegin;
+  if (ctx->distributed) {
+    PetscCall(SVDSolve_LAPACK_Distributed(svd));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
   PetscCall(MatCreateRedundantMatrix(svd->OP,0,PETSC_COMM_SELF,MAT_INITIAL_MATRIX,&Ar));
   PetscCall(MatConvert(Ar,MATSEQDENSE,MAT_INITIAL_MATRIX,&mat));
@@ -246,13 +320,26 @@ static PetscErrorCode SVDSetDSType_LAPACK(SVD svd)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDDestroy_LAPACK(SVD svd)
+{
+  PetscFunctionBegin;
+  PetscCall(PetscFree(svd->data));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 SLEPC_EXTERN PetscErrorCode SVDCreate_LAPACK(SVD svd)
 {
+  SVD_LAPACK     *ctx;
+
   PetscFunctionBegin;
+  PetscCall(PetscNew(&ctx));
+  svd->data = (void*)ctx;
+
   svd->ops->setup     = SVDSetUp_LAPACK;
   svd->ops->solve     = SVDSolve_LAPACK;
   svd->ops->solveg    = SVDSolve_LAPACK_GSVD;
   svd->ops->solveh    = SVDSolve_LAPACK_HSVD;
   svd->ops->setdstype = SVDSetDSType_LAPACK;
+  svd->ops->destroy   = SVDDestroy_LAPACK;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -33,7 +33,6 @@ static PetscErrorCode SVDSetUp_Randomized(SVD svd)
   PetscFunctionBegin;
   SVDCheckStandard(svd);
   SVDCheckDefinite(svd);
-  SVDCheckUnsupported(svd,SVD_FEATURE_THRESHOLD);
   PetscCheck(svd->which==SVD_LARGEST,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"This solver supports only largest singular values");
   PetscCall(MatGetSize(svd->A,NULL,&N));
   PetscCall(SVDSetDimensions_Default(svd));
@@ -75,28 +74,42 @@ static PetscErrorCode SVDRandomizedResidualNorm(SVD svd,PetscInt i,PetscScalar s
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-/* If A is a virtual Hermitian transpose, then BVMatMult will fail if PRODUCT_AhB is not implemented */
-static PetscErrorCode BlockMatMult(BV V,Mat A,BV Y,Mat AT)
+/*
+   Enlarge the subspace in the threshold stopping test, doubling its size (the
+   storage is reallocated geometrically) and completing it with random vectors
+*/
+static PetscErrorCode SVDRandomizedGrow(SVD svd,PetscScalar **w)
 {
+  PetscInt    i,M,N,ncv;
+  PetscScalar *aux;
+
   PetscFunctionBegin;
-  if (!PetscDefined(USE_COMPLEX)) PetscCall(BVMatMult(V,A,Y));
-  else {
-    PetscBool flg=PETSC_FALSE;
-    PetscCall(PetscObjectTypeCompare((PetscObject)A,MATHERMITIANTRANSPOSEVIRTUAL,&flg));
-    if (flg) PetscCall(BVMatMultHermitianTranspose(V,AT,Y));
-    else PetscCall(BVMatMult(V,A,Y));
-  }
+  PetscCall(MatGetSize(svd->A,&M,&N));
+  ncv = PetscMin(2*svd->ncv,PetscMin(M,N));
+  PetscCall(PetscInfo(svd,"Enlarging the subspace to %" PetscInt_FMT " vectors\n",ncv));
+  PetscCall(SVDReallocateSolution(svd,ncv));
+  for (i=svd->ncv;i<ncv;i++) svd->perm[i] = i;
+  PetscCall(DSReallocate(svd->ds,ncv));
+  aux = *w;
+  PetscCall(PetscCalloc1(ncv,w));
+  PetscCall(PetscArraycpy(*w,aux,svd->ncv));
+  PetscCall(PetscFree(aux));
+  PetscCall(BVSetActiveColumns(svd->V,svd->ncv,ncv));
+  PetscCall(BVSetRandomNormal(svd->V));
+  svd->ncv = ncv;
+  svd->mpd = ncv;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
 static PetscErrorCode SVDSolve_Randomized(SVD svd)
 {
   PetscScalar    *w;
-  PetscReal      res=1.0;
-  PetscInt       i,k=0;
+  PetscReal      res=1.0,thres;
+  PetscInt       i,k=0,M,N;
   Mat            A,U,V;
 
   PetscFunctionBegin;
+  PetscCall(MatGetSize(svd->A,&M,&N));
   /* Form random matrix, G. Complete the initial basis with random vectors */
   PetscCall(BVSetActiveColumns(svd->V,svd->nini,svd->ncv));
   PetscCall(BVSetRandomNormal(svd->V));
@@ -108,11 +121,11 @@ static PetscErrorCode SVDSolve_Randomized(SVD svd)
     PetscCall(BVSetActiveColumns(svd->V,svd->nconv,svd->ncv));
     PetscCall(BVSetActiveColumns(svd->U,svd->nconv,svd->ncv));
     /* Form AG */
-    PetscCall(BlockMatMult(svd->V,svd->A,svd->U,svd->AT));
+    PetscCall(SVDBlockMatMult(svd->V,svd->A,svd->U,svd->AT));
     /* Orthogonalization Q=qr(AG)*/
     PetscCall(BVOrthogonalize(svd->U,NULL));
     /* Form B^*= AQ */
-    PetscCall(BlockMatMult(svd->U,svd->AT,svd->V,svd->A));
+    PetscCall(SVDBlockMatMult(svd->U,svd->AT,svd->V,svd->A));
 
     PetscCall(DSSetDimensions(svd->ds,svd->ncv,svd->nconv,svd->ncv));
     PetscCall(DSSVDSetDimensions(svd->ds,svd->ncv));
@@ -143,9 +156,15 @@ static PetscErrorCode SVDSolve_Randomized(SVD svd)
       k = svd->nsv;
       for (i=0;i<svd->ncv;i++) svd->sigma[i] = PetscRealPart(w[i]);
     }
+    SVDSetCtxThreshold(svd,svd->sigma,svd->nconv+k);
     PetscCall((*svd->stopping)(svd,svd->its,svd->max_it,svd->nconv+k,svd->nsv,&svd->reason,svd->stoppingctx));
     svd->nconv += k;
     PetscCall(SVDMonitor(svd,svd->its,svd->nconv,svd->sigma,svd->errest,svd->ncv));
+    /* in the threshold test, enlarge the subspace if it cannot contain the wanted singular values */
+    if (svd->reason == SVD_CONVERGED_ITERATING && svd->stop==SVD_STOP_THRESHOLD && svd->ncv<PetscMin(M,N)) {
+      thres = svd->threlative? svd->thres*svd->sigma[0]: svd->thres;
+      if (svd->ncv-svd->nconv<5 || PetscRealPart(w[svd->ncv-1])>thres) PetscCall(SVDRandomizedGrow(svd,&w));
+    }
   } while (svd->reason == SVD_CONVERGED_ITERATING);
   PetscCall(PetscFree(w));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -61,8 +61,12 @@ typedef struct {
   PetscReal           scalef;    /* scale factor for matrix B */
   PetscReal           scaleth;   /* scale threshold for automatic scaling */
   PetscBool           explicitmatrix;
+  PetscInt            bs;        /* block size of the block variant */
+  PetscBool           inexact;   /* adapt the tolerance of inner solves in GSVD */
   /* auxiliary variables */
   Mat                 Z;         /* aux matrix for GSVD, Z=[A;B] */
+  PetscReal           rtol0;     /* tolerance of the inner solver set by the user */
+  PetscBool           rtolset;   /* the tolerance of the inner solver has been modified */
 } SVD_TRLANCZOS;
 
 /* Context for shell matrix [A; B] */
@@ -200,6 +204,9 @@ static PetscErrorCode MatCreateVecs_Z(Mat Z,Vec *right,Vec *left)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDSolve_TRLanczos(SVD);
+static PetscErrorCode SVDSolve_TRLanczos_Block(SVD);
+
 static PetscErrorCode SVDSetUp_TRLanczos(SVD svd)
 {
   PetscInt       M,N,P,m,n,p;
@@ -214,8 +221,13 @@ static PetscErrorCode SVDSetUp_TRLanczos(SVD svd)
   PetscCheck(lanczos->lock || svd->mpd>=svd->ncv,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Should not use mpd parameter in non-locking variant");
   if (svd->max_it==PETSC_DETERMINE) svd->max_it = PetscMax(N/svd->ncv,100)*((svd->stop==SVD_STOP_THRESHOLD)?10:1);
   if (!lanczos->keep) lanczos->keep = 0.5;
+  if (lanczos->bs>1) {
+    PetscCheck(!svd->isgeneralized && !svd->ishyperbolic,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"The block variant is only available for standard SVD problems");
+    PetscCheck(svd->mpd>lanczos->bs,PetscObjectComm((PetscObject)svd),PETSC_ERR_USER_INPUT,"The value of mpd must be larger than the block size");
+  }
+  svd->ops->solve = (lanczos->bs>1)? SVDSolve_TRLanczos_Block: SVDSolve_TRLanczos;
   svd->leftbasis = PETSC_TRUE;
-  PetscCall(SVDAllocateSolution(svd,1));
+  PetscCall(SVDAllocateSolution(svd,PetscMax(lanczos->bs,1)));
   if (svd->isgeneralized) {
     PetscCall(MatGetSize(svd->B,&P,NULL));
     if (lanczos->bidiag == SVD_TRLANCZOS_GBIDIAG_LOWER && ((svd->which==SVD_LARGEST && P<=N) || (svd->which==SVD_SMALLEST && M>N && P<=N))) {
@@ -254,9 +266,15 @@ static PetscErrorCode SVDSetUp_TRLanczos(SVD svd)
     PetscCall(BV_SetMatrixDiagonal(svd->swapped?svd->V:svd->U,svd->omega,svd->OP));
     PetscCall(SVDSetWorkVecs(svd,1,0));
   }
-  PetscCall(DSSetCompact(svd->ds,PETSC_TRUE));
-  PetscCall(DSSetExtraRow(svd->ds,PETSC_TRUE));
-  PetscCall(DSAllocate(svd->ds,svd->ncv+1));
+  if (lanczos->bs>1) {  /* dense projected matrix */
+    PetscCall(DSSetCompact(svd->ds,PETSC_FALSE));
+    PetscCall(DSSetExtraRow(svd->ds,PETSC_FALSE));
+    PetscCall(DSAllocate(svd->ds,svd->ncv));
+  } else {
+    PetscCall(DSSetCompact(svd->ds,PETSC_TRUE));
+    PetscCall(DSSetExtraRow(svd->ds,PETSC_TRUE));
+    PetscCall(DSAllocate(svd->ds,svd->ncv+1));
+  }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -447,9 +465,20 @@ static PetscErrorCode SVDOneSideTRLanczosCGS(SVD svd,PetscReal *alpha,PetscReal
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
-static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
+/*
+   SVDThickRestartLanczos - Thick-restart Lanczos bidiagonalization on the bases svd->V
+   and svd->U, with the projected problem in svd->ds (DSSVD, compact with extra row).
+   It is the solver of SVDTRLANCZOS for standard problems, and it is also used by the
+   structured variant of SVDCYCLIC, since the Lanczos recurrence of the cyclic matrix
+   started from [0;v] reduces to this bidiagonalization.
+
+   Input Parameters:
+     oneside - whether to use the one-sided variant
+     keep    - proportion of vectors kept at restart
+     lock    - whether converged triplets are locked
+*/
+PetscErrorCode SVDThickRestartLanczos(SVD svd,PetscBool oneside,PetscReal keep,PetscBool lock)
 {
-  SVD_TRLANCZOS  *lanczos = (SVD_TRLANCZOS*)svd->data;
   PetscReal      *alpha,*beta;
   PetscScalar    *swork=NULL,*w,*aux;
   PetscInt       i,k,l,nv,ld;
@@ -458,12 +487,11 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
   BVOrthogType   orthog;
 
   PetscFunctionBegin;
-  PetscCall(PetscCitationsRegister(citation,&cited));
   /* allocate working space */
   PetscCall(DSGetLeadingDimension(svd->ds,&ld));
   PetscCall(BVGetOrthogonalization(svd->V,&orthog,NULL,NULL,NULL));
   PetscCall(PetscMalloc1(ld,&w));
-  if (lanczos->oneside) PetscCall(PetscMalloc1(svd->ncv+1,&swork));
+  if (oneside) PetscCall(PetscMalloc1(svd->ncv+1,&swork));
 
   /* normalize start vector */
   if (!svd->nini) {
@@ -479,7 +507,7 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
     nv = PetscMin(svd->nconv+svd->mpd,svd->ncv);
     PetscCall(DSGetArrayReal(svd->ds,DS_MAT_T,&alpha));
     beta = alpha + ld;
-    if (lanczos->oneside) {
+    if (oneside) {
       if (orthog == BV_ORTHOG_MGS) PetscCall(SVDOneSideTRLanczosMGS(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
       else PetscCall(SVDOneSideTRLanczosCGS(svd,alpha,beta,svd->V,svd->U,svd->nconv,l,nv,swork));
     } else PetscCall(SVDTwoSideLanczos(svd,alpha,beta,svd->V,svd->U,svd->nconv+l,&nv,&breakdown));
@@ -505,8 +533,8 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
 
     /* update l */
     if (svd->reason != SVD_CONVERGED_ITERATING || breakdown || k==nv) l = 0;
-    else l = PetscMax(1,(PetscInt)((nv-k)*lanczos->keep));
-    if (!lanczos->lock && l>0) { l += k; k = 0; } /* non-locking variant: reset no. of converged triplets */
+    else l = PetscMax(1,(PetscInt)((nv-k)*keep));
+    if (!lock && l>0) { l += k; k = 0; } /* non-locking variant: reset no. of converged triplets */
     if (l) PetscCall(PetscInfo(svd,"Preparing to restart keeping l=%" PetscInt_FMT " vectors\n",l));
 
     if (svd->reason == SVD_CONVERGED_ITERATING) {
@@ -534,7 +562,7 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
 
     if (svd->reason == SVD_CONVERGED_ITERATING && !breakdown) {
       PetscCall(BVCopyColumn(svd->V,nv,k+l));  /* copy the last vector to be the next initial vector */
-      if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+      if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
         svd->ncv = svd->mpd+k;
         PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
         for (i=nv;i<svd->ncv;i++) svd->perm[i] = i;
@@ -544,7 +572,7 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
         PetscCall(PetscArraycpy(w,aux,ld));
         PetscCall(PetscFree(aux));
         PetscCall(DSGetLeadingDimension(svd->ds,&ld));
-        if (lanczos->oneside) {
+        if (oneside) {
           PetscCall(PetscFree(swork));
           PetscCall(PetscMalloc1(svd->ncv+1,&swork));
         }
@@ -556,7 +584,7 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
   }
 
   /* orthonormalize U columns in one side method */
-  if (lanczos->oneside) {
+  if (oneside) {
     for (i=0;i<svd->nconv;i++) PetscCall(BVOrthonormalizeColumn(svd->U,i,PETSC_FALSE,NULL,NULL));
   }
 
@@ -567,6 +595,228 @@ static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDSolve_TRLanczos(SVD svd)
+{
+  SVD_TRLANCZOS  *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  PetscCall(PetscCitationsRegister(citation,&cited));
+  PetscCall(SVDThickRestartLanczos(svd,lanczos->oneside,lanczos->keep,lanczos->lock));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Orthonormalize columns s:e-1 of X one at a time against all the previous columns.
+   If R is given, column j of R receives the coefficients of column j, as in
+   BVOrthogonalize(). A column that is linearly dependent on the previous ones is
+   replaced by a random vector orthonormal to them and its diagonal entry in R is
+   set to zero, so that a rank-deficient block does not cause a breakdown.
+*/
+static PetscErrorCode SVDBlockOrthonormalize(BV X,PetscInt s,PetscInt e,Mat R)
+{
+  PetscInt    i,j,l,k,ldr=0;
+  PetscScalar *h,*pR;
+  PetscReal   norm;
+  PetscBool   lindep;
+
+  PetscFunctionBegin;
+  PetscCall(BVGetActiveColumns(X,&l,&k));
+  PetscCall(BVSetActiveColumns(X,0,e));
+  PetscCall(PetscMalloc1(e,&h));
+  if (R) PetscCall(MatDenseGetLDA(R,&ldr));
+  for (j=s;j<e;j++) {
+    PetscCall(BVOrthogonalizeColumn(X,j,h,&norm,&lindep));
+    if (norm==0.0 || lindep) {
+      PetscCall(PetscInfo(X,"Linearly dependent column %" PetscInt_FMT " replaced by a random vector\n",j));
+      PetscCall(BVSetRandomColumn(X,j));
+      PetscCall(BVOrthonormalizeColumn(X,j,PETSC_TRUE,NULL,NULL));
+      norm = 0.0;
+    } else PetscCall(BVScaleColumn(X,j,1.0/norm));
+    if (R) {
+      PetscCall(MatDenseGetArray(R,&pR));
+      for (i=0;i<j;i++) pR[i+j*ldr] = h[i];
+      pR[j+j*ldr] = norm;
+      for (i=j+1;i<e;i++) pR[i+j*ldr] = 0.0;
+      PetscCall(MatDenseRestoreArray(R,&pR));
+    }
+  }
+  PetscCall(PetscFree(h));
+  PetscCall(BVSetActiveColumns(X,l,k));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Block Golub-Kahan-Lanczos bidiagonalization with thick restart. Each step multiplies
+   a block of bs vectors by A and by A^*, with SpMM via BVMatMult(), and orthonormalizes
+   them against the previous ones with SVDBlockOrthonormalize(). The projected matrix H=U'*A*V
+   is built column-wise from the R factors of the blocks of U, so it is block upper
+   bidiagonal, with a dense coupling block after a restart, and it is solved with a dense
+   DSSVD. The factorization satisfies A*V = U*H and A'*U = V*H' + V_next*R*E', where R is
+   the triangular factor of the last block of V, that gives the residual norms. Linearly
+   dependent directions are replaced by random ones with a zero entry in R, so a
+   rank-deficient block does not cause a breakdown.
+*/
+static PetscErrorCode SVDSolve_TRLanczos_Block(SVD svd)
+{
+  SVD_TRLANCZOS     *lanczos = (SVD_TRLANCZOS*)svd->data;
+  PetscInt          i,j,p,b,bl=0,k,l=0,nv,nvnext,ld,ldr,marker,bs=lanczos->bs;
+  PetscScalar       *w,*A,*pU,*Rl,t;
+  const PetscScalar *pR;
+  PetscReal         resnorm;
+  Mat               R,U,V;
+
+  PetscFunctionBegin;
+  PetscCall(PetscCitationsRegister(citation,&cited));
+  PetscCall(DSGetLeadingDimension(svd->ds,&ld));
+  ldr = svd->ncv+bs;
+  PetscCall(PetscMalloc2(ld,&w,bs*bs,&Rl));
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,ldr,ldr,NULL,&R));
+
+  /* complete and orthonormalize the initial block */
+  for (i=svd->nini;i<bs;i++) PetscCall(BVSetRandomColumn(svd->V,i));
+  PetscCall(SVDBlockOrthonormalize(svd->V,PetscMin(svd->nini,bs),bs,NULL));
+
+  while (svd->reason == SVD_CONVERGED_ITERATING) {
+    svd->its++;
+    nv = PetscMin(svd->nconv+svd->mpd,svd->ncv);
+
+    /* the kept part of the projected matrix is diagonal after restart */
+    PetscCall(DSGetArray(svd->ds,DS_MAT_A,&A));
+    for (j=svd->nconv;j<svd->nconv+l;j++) {
+      for (i=0;i<nv;i++) A[i+j*ld] = 0.0;
+      A[j+j*ld] = svd->sigma[j];
+    }
+    PetscCall(DSRestoreArray(svd->ds,DS_MAT_A,&A));
+
+    /* block bidiagonalization */
+    for (p=svd->nconv+l;p<nv;p+=b) {
+      b = PetscMin(bs,nv-p);
+      /* U_j = A*V_j, orthogonalized against previous columns of U */
+      PetscCall(BVSetActiveColumns(svd->V,p,p+b));
+      PetscCall(BVSetActiveColumns(svd->U,p,p+b));
+      PetscCall(SVDBlockMatMult(svd->V,svd->A,svd->U,svd->AT));
+      PetscCall(SVDBlockOrthonormalize(svd->U,p,p+b,R));
+      PetscCall(DSGetArray(svd->ds,DS_MAT_A,&A));
+      PetscCall(MatDenseGetArrayRead(R,&pR));
+      for (j=p;j<p+b;j++) {
+        for (i=0;i<p+b;i++) A[i+j*ld] = pR[i+j*ldr];
+        for (;i<nv;i++) A[i+j*ld] = 0.0;
+      }
+      PetscCall(MatDenseRestoreArrayRead(R,&pR));
+      PetscCall(DSRestoreArray(svd->ds,DS_MAT_A,&A));
+      /* V_{j+1} = A'*U_j, orthogonalized against previous columns of V */
+      PetscCall(BVSetActiveColumns(svd->V,p+b,p+2*b));
+      PetscCall(SVDBlockMatMult(svd->U,svd->AT,svd->V,svd->A));
+      PetscCall(SVDBlockOrthonormalize(svd->V,p+b,p+2*b,R));
+      PetscCall(MatDenseGetArrayRead(R,&pR));
+      for (j=0;j<b;j++) for (i=0;i<b;i++) Rl[i+j*bs] = pR[p+b+i+(p+b+j)*ldr];
+      PetscCall(MatDenseRestoreArrayRead(R,&pR));
+      bl = b;
+    }
+    PetscCall(BVSetActiveColumns(svd->V,svd->nconv,nv));
+    PetscCall(BVSetActiveColumns(svd->U,svd->nconv,nv));
+
+    /* solve projected problem */
+    PetscCall(DSSetDimensions(svd->ds,nv,svd->nconv,svd->nconv+l));
+    PetscCall(DSSVDSetDimensions(svd->ds,nv));
+    PetscCall(DSSetState(svd->ds,DS_STATE_RAW));
+    PetscCall(DSSolve(svd->ds,w,NULL));
+    PetscCall(DSSort(svd->ds,w,NULL,NULL,NULL,NULL));
+    PetscCall(DSSynchronize(svd->ds,w,NULL));
+    for (i=svd->nconv;i<nv;i++) svd->sigma[i] = PetscRealPart(w[i]);
+
+    /* check convergence, the residual of triplet i is R*U(nv-bl:nv,i) */
+    if (PetscUnlikely(svd->conv == SVD_CONV_MAXIT && svd->its >= svd->max_it)) k = PetscMin(svd->nsv,nv);
+    else {
+      marker = -1;
+      PetscCall(DSGetArray(svd->ds,DS_MAT_U,&pU));
+      for (k=svd->nconv;k<nv;k++) {
+        resnorm = 0.0;
+        for (i=0;i<bl;i++) {
+          t = 0.0;
+          for (j=0;j<bl;j++) t += Rl[i+j*bs]*pU[nv-bl+j+k*ld];
+          resnorm = SlepcAbs(resnorm,PetscAbsScalar(t));
+        }
+        PetscCall((*svd->converged)(svd,svd->sigma[k],resnorm,&svd->errest[k],svd->convergedctx));
+        if (marker==-1 && svd->errest[k] >= svd->tol) marker = k;
+        if (marker!=-1 && !svd->trackall) break;
+      }
+      PetscCall(DSRestoreArray(svd->ds,DS_MAT_U,&pU));
+      if (marker!=-1) k = marker;
+    }
+    SVDSetCtxThreshold(svd,svd->sigma,k);
+    PetscCall((*svd->stopping)(svd,svd->its,svd->max_it,k,svd->nsv,&svd->reason,svd->stoppingctx));
+
+    /* update l, leaving room for at least one block in the next expansion */
+    if (svd->reason != SVD_CONVERGED_ITERATING || k==nv) l = 0;
+    else {
+      nvnext = PetscMin(k+svd->mpd,svd->ncv);
+      l = PetscMax(1,(PetscInt)((nv-k)*lanczos->keep));
+      l = PetscMax(0,PetscMin(l,nvnext-k-bs));
+    }
+    if (!lanczos->lock && l>0) { l += k; k = 0; } /* non-locking variant: reset no. of converged triplets */
+    if (l) PetscCall(PetscInfo(svd,"Preparing to restart keeping l=%" PetscInt_FMT " vectors\n",l));
+
+    /* compute converged singular vectors and restart vectors */
+    PetscCall(DSGetMat(svd->ds,DS_MAT_V,&V));
+    PetscCall(BVMultInPlace(svd->V,V,svd->nconv,k+l));
+    PetscCall(DSRestoreMat(svd->ds,DS_MAT_V,&V));
+    PetscCall(DSGetMat(svd->ds,DS_MAT_U,&U));
+    PetscCall(BVMultInPlace(svd->U,U,svd->nconv,k+l));
+    PetscCall(DSRestoreMat(svd->ds,DS_MAT_U,&U));
+
+    if (svd->reason == SVD_CONVERGED_ITERATING) {
+      /* the residual block becomes the next block, completed with random vectors if needed */
+      for (j=0;j<bl;j++) PetscCall(BVCopyColumn(svd->V,nv+j,k+l+j));
+      if (bl<bs) {
+        for (j=bl;j<bs;j++) PetscCall(BVSetRandomColumn(svd->V,k+l+j));
+        PetscCall(SVDBlockOrthonormalize(svd->V,k+l+bl,k+l+bs,NULL));
+      }
+    }
+
+    svd->nconv = k;
+    PetscCall(SVDMonitor(svd,svd->its,svd->nconv,svd->sigma,svd->errest,nv));
+  }
+
+  PetscCall(MatDestroy(&R));
+  PetscCall(PetscFree2(w,Rl));
+  PetscCall(DSTruncate(svd->ds,svd->nconv,PETSC_TRUE));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Normalize u = u/nrm and compute ou = Omega*u in a single pass over the vectors
+*/
+static inline PetscErrorCode SVDLanczosHSVDScaleSignature(SVD svd,PetscReal nrm,Vec u,Vec ou)
+{
+  PetscInt          i,n;
+  PetscScalar       *pu,*pou,alpha;
+  const PetscScalar *pom;
+  PetscBool         host;
+
+  PetscFunctionBegin;
+  alpha = (nrm!=0.0)? 1.0/nrm: 1.0;
+  PetscCall(PetscObjectTypeCompareAny((PetscObject)u,&host,VECSEQ,VECMPI,""));
+  if (!host) {  /* let the vector type do it in two steps, to avoid copies between memory spaces */
+    if (alpha!=1.0) PetscCall(VecScale(u,alpha));
+    PetscCall(VecPointwiseMult(ou,svd->omega,u));
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+  PetscCall(VecGetLocalSize(u,&n));
+  PetscCall(VecGetArray(u,&pu));
+  PetscCall(VecGetArrayWrite(ou,&pou));
+  PetscCall(VecGetArrayRead(svd->omega,&pom));
+  for (i=0;i<n;i++) {
+    pu[i] *= alpha;
+    pou[i] = pom[i]*pu[i];
+  }
+  PetscCall(VecRestoreArrayRead(svd->omega,&pom));
+  PetscCall(VecRestoreArrayWrite(ou,&pou));
+  PetscCall(VecRestoreArray(u,&pu));
+  PetscCall(PetscLogFlops(2.0*n));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDLanczosHSVD(SVD svd,PetscReal *alpha,PetscReal *beta,PetscReal *omega,Mat A,Mat AT,BV V,BV U,PetscInt k,PetscInt *n,PetscBool *breakdown)
 {
   PetscInt       i;
@@ -581,16 +831,17 @@ static PetscErrorCode SVDLanczosHSVD(SVD svd,PetscReal *alpha,PetscReal *beta,Pe
     PetscCall(MatMult(A,v,u));
     PetscCall(BVRestoreColumn(V,i,&v));
     PetscCall(BVRestoreColumn(U,i,&u));
-    PetscCall(BVOrthonormalizeColumn(U,i,PETSC_FALSE,alpha+i,&lindep));
+    PetscCall(BVOrthogonalizeColumn(U,i,NULL,alpha+i,&lindep));
     omega[i] = PetscSign(alpha[i]);
     if (PetscUnlikely(lindep)) {
       *n = i;
       break;
     }
 
+    /* the normalization of u is fused with the application of the signature */
     PetscCall(BVGetColumn(V,i+1,&v));
     PetscCall(BVGetColumn(U,i,&u));
-    PetscCall(VecPointwiseMult(ou,svd->omega,u));
+    PetscCall(SVDLanczosHSVDScaleSignature(svd,alpha[i],u,ou));
     PetscCall(MatMult(AT,ou,v));
     PetscCall(BVRestoreColumn(V,i+1,&v));
     PetscCall(BVRestoreColumn(U,i,&u));
@@ -718,7 +969,7 @@ static PetscErrorCode SVDSolve_TRLanczos_HSVD(SVD svd)
       PetscCall(BVSetSignature(U,vomega));
       PetscCall(DSRestoreMatAndColumn(svd->ds,DS_MAT_D,0,&D,&vomega));
 
-      if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+      if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
         svd->ncv = svd->mpd+k;
         PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
         for (i=nv;i<svd->ncv;i++) svd->perm[i] = i;
@@ -741,6 +992,81 @@ static PetscErrorCode SVDSolve_TRLanczos_HSVD(SVD svd)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/* Set the tolerance of the least-squares solver for the next bidiagonalization (inexact variant).
+   The tolerance of the KSP is used until the outer iteration makes progress, and then it is
+   relaxed in inverse proportion to the residual estimate of the first unconverged triplet */
+static PetscErrorCode SVDLanczosGUpdateInnerTol(SVD svd,PetscInt k,PetscInt nv)
+{
+  SVD_TRLANCZOS  *lanczos = (SVD_TRLANCZOS*)svd->data;
+  PetscReal      rtol;
+
+  PetscFunctionBegin;
+  if (!lanczos->inexact) PetscFunctionReturn(PETSC_SUCCESS);
+  if (!lanczos->rtolset) {
+    PetscCall(KSPGetTolerances(lanczos->ksp,&lanczos->rtol0,NULL,NULL,NULL));
+    lanczos->rtolset = PETSC_TRUE;
+  }
+  if (svd->reason != SVD_CONVERGED_ITERATING || k>=nv || svd->errest[k]<=0.0) rtol = lanczos->rtol0;
+  else rtol = PetscMax(lanczos->rtol0,PetscMin(0.01,lanczos->rtol0/svd->errest[k]));
+  PetscCall(PetscInfo(svd,"Setting inner tolerance to %g\n",(double)rtol));
+  PetscCall(KSPSetTolerances(lanczos->ksp,rtol,PETSC_CURRENT,PETSC_CURRENT,PETSC_CURRENT));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Restore the tolerance of the KSP modified by SVDLanczosGUpdateInnerTol(), also called
+   from other entry points in case the previous solve was interrupted by an error */
+static PetscErrorCode SVDLanczosGRestoreInnerTol(SVD svd)
+{
+  SVD_TRLANCZOS  *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (!lanczos->rtolset) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(KSPSetTolerances(lanczos->ksp,lanczos->rtol0,PETSC_CURRENT,PETSC_CURRENT,PETSC_CURRENT));
+  lanczos->rtolset = PETSC_FALSE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/* Inexact variant: the residual estimates of the bidiagonalization do not account for the
+   error of the inner solves, so the true residuals of the converged triplets are computed
+   and only the leading triplets that satisfy the convergence criterion are accepted */
+static PetscErrorCode SVDLanczosGCheckResiduals(SVD svd)
+{
+  PetscInt       i;
+  PetscReal      sigma,norm1,norm2,vecnorm,err;
+  Vec            x,uv,y,z;
+
+  PetscFunctionBegin;
+  if (svd->converged==SVDConvergedNorm) {
+    if (!svd->nrma) PetscCall(MatNorm(svd->OP,NORM_INFINITY,&svd->nrma));
+    if (!svd->nrmb) PetscCall(MatNorm(svd->OPb,NORM_INFINITY,&svd->nrmb));
+  }
+  PetscCall(MatCreateVecs(svd->OP,&y,NULL));
+  PetscCall(VecDuplicate(y,&z));
+
+  for (i=0;i<svd->nconv;i++) {
+    sigma = svd->sigma[i];
+    PetscCall(BVGetColumn(svd->U,i,&uv));
+    PetscCall(BVGetColumn(svd->V,i,&x));
+    PetscCall(SVDComputeResidualNorms_Generalized(svd,sigma,uv,x,y,z,&norm1,&norm2));
+    PetscCall(VecNorm(x,NORM_2,&vecnorm));
+    PetscCall(BVRestoreColumn(svd->V,i,&x));
+    PetscCall(BVRestoreColumn(svd->U,i,&uv));
+    vecnorm = PetscSqrtReal(1.0+vecnorm*vecnorm);
+    PetscCall((*svd->converged)(svd,sigma,SlepcAbs(norm1,norm2)/vecnorm,&err,svd->convergedctx));
+    if (err>svd->tol) break;
+    svd->errest[i] = err;
+  }
+  if (i<svd->nconv) {
+    PetscCall(PetscInfo(svd,"Only %" PetscInt_FMT " of %" PetscInt_FMT " triplets satisfy the convergence criterion with the true residual\n",i,svd->nconv));
+    svd->nconv = i;
+    if (svd->reason==SVD_CONVERGED_TOL && svd->nconv<svd->nsv) svd->reason = SVD_DIVERGED_BREAKDOWN;
+  }
+
+  PetscCall(VecDestroy(&z));
+  PetscCall(VecDestroy(&y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /* Given n computed generalized singular values in sigmain, backtransform them
    in sigmaout by undoing scaling and reciprocating if swapped=true. Also updates vectors V
    if given. If sigmaout=NULL then the result overwrites sigmain. */
@@ -927,6 +1253,7 @@ static PetscErrorCode SVDSolve_TRLanczosGSingle(SVD svd,BV U1,BV V)
     PetscCall(SVDLanczosBackTransform(svd,nv,svd->sigma,sigma,NULL));
     SVDSetCtxThreshold(svd,sigma,k);
     PetscCall((*svd->stopping)(svd,svd->its,svd->max_it,k,svd->nsv,&svd->reason,svd->stoppingctx));
+    PetscCall(SVDLanczosGUpdateInnerTol(svd,k,nv));
 
     sigma0 = svd->which==SVD_LARGEST? svd->sigma[0] : 1.0/svd->sigma[0];
     if (scaleth!=0 && k==0 && sigma0>scaleth) {
@@ -971,7 +1298,7 @@ static PetscErrorCode SVDSolve_TRLanczosGSingle(SVD svd,BV U1,BV V)
 
       if (svd->reason == SVD_CONVERGED_ITERATING && !breakdown) {
         PetscCall(BVCopyColumn(U1,nv,k+l));  /* copy the last vector to be the next initial vector */
-        if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+        if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
           svd->ncv = svd->mpd+k;
           PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
           PetscCall(BVResize(V,svd->ncv+1,PETSC_TRUE));
@@ -1211,6 +1538,7 @@ static PetscErrorCode SVDSolve_TRLanczosGUpper(SVD svd,BV U1,BV U2,BV V)
     PetscCall(SVDLanczosBackTransform(svd,nv,svd->sigma,sigma,NULL));
     SVDSetCtxThreshold(svd,sigma,k);
     PetscCall((*svd->stopping)(svd,svd->its,svd->max_it,k,svd->nsv,&svd->reason,svd->stoppingctx));
+    PetscCall(SVDLanczosGUpdateInnerTol(svd,k,nv));
 
     sigma0 = svd->which==SVD_LARGEST? svd->sigma[0] : 1.0/svd->sigma[0];
     if (lanczos->scaleth!=0 && k==0 && sigma0>lanczos->scaleth) {
@@ -1259,7 +1587,7 @@ static PetscErrorCode SVDSolve_TRLanczosGUpper(SVD svd,BV U1,BV U2,BV V)
 
       if (svd->reason == SVD_CONVERGED_ITERATING && !breakdown) {
         PetscCall(BVCopyColumn(V,nv,k+l));  /* copy the last vector to be the next initial vector */
-        if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+        if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
           svd->ncv = svd->mpd+k;
           PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
           PetscCall(BVResize(U1,svd->ncv+1,PETSC_TRUE));
@@ -1525,6 +1853,7 @@ static PetscErrorCode SVDSolve_TRLanczosGLower(SVD svd,BV U1,BV U2,BV V)
     PetscCall(SVDLanczosBackTransform(svd,nv,svd->sigma,sigma,NULL));
     SVDSetCtxThreshold(svd,sigma,k);
     PetscCall((*svd->stopping)(svd,svd->its,svd->max_it,k,svd->nsv,&svd->reason,svd->stoppingctx));
+    PetscCall(SVDLanczosGUpdateInnerTol(svd,k,nv));
 
     sigma0 = inverted? 1.0/svd->sigma[0] : svd->sigma[0];
     if (lanczos->scaleth!=0 && k==0 && sigma0>lanczos->scaleth) {
@@ -1575,7 +1904,7 @@ static PetscErrorCode SVDSolve_TRLanczosGLower(SVD svd,BV U1,BV U2,BV V)
 
       if (svd->reason == SVD_CONVERGED_ITERATING && !breakdown) {
         PetscCall(BVCopyColumn(V,nv,k+l));  /* copy the last vector to be the next initial vector */
-        if (svd->stop==SVD_STOP_THRESHOLD && nv-k<5) {  /* reallocate */
+        if (SVDThresholdGrow(svd,k,nv)) {  /* reallocate */
           svd->ncv = svd->mpd+k;
           PetscCall(SVDReallocateSolution(svd,svd->ncv+1));
           PetscCall(BVResize(U1,svd->ncv+1,PETSC_TRUE));
@@ -1656,6 +1985,7 @@ static PetscErrorCode SVDSolve_TRLanczos_GSVD(SVD svd)
     PetscCall(VecDestroy(&nest));
   }
 
+  PetscCall(SVDLanczosGRestoreInnerTol(svd));  /* in case the previous solve was interrupted */
   switch (lanczos->bidiag) {
     case SVD_TRLANCZOS_GBIDIAG_SINGLE:
       PetscCall(SVDSolve_TRLanczosGSingle(svd,U1,svd->U));
@@ -1670,6 +2000,7 @@ static PetscErrorCode SVDSolve_TRLanczos_GSVD(SVD svd)
   }
 
   /* Compute converged right singular vectors */
+  PetscCall(SVDLanczosGRestoreInnerTol(svd));
   PetscCall(BVSetActiveColumns(svd->U,0,svd->nconv));
   PetscCall(BVSetActiveColumns(svd->V,0,svd->nconv));
   PetscCall(BVGetMat(svd->U,&U));
@@ -1692,11 +2023,12 @@ static PetscErrorCode SVDSolve_TRLanczos_GSVD(SVD svd)
 
   /* undo scaling and compute the reciprocals of sigma if matrices were swapped */
   PetscCall(SVDLanczosBackTransform(svd,svd->nconv,svd->sigma,NULL,svd->V));
+  if (convchg) svd->converged = SVDConvergedNorm;
+  if (lanczos->inexact) PetscCall(SVDLanczosGCheckResiduals(svd));
 
   PetscCall(BVDestroy(&U1));
   PetscCall(BVDestroy(&U2));
   PetscCall(DSTruncate(svd->ds,svd->nconv,PETSC_TRUE));
-  if (convchg) svd->converged = SVDConvergedNorm;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
@@ -1705,6 +2037,7 @@ static PetscErrorCode SVDSetFromOptions_TRLanczos(SVD svd,PetscOptionItems *Pets
   SVD_TRLANCZOS       *lanczos = (SVD_TRLANCZOS*)svd->data;
   PetscBool           flg,val,lock;
   PetscReal           keep,scale;
+  PetscInt            bs;
   SVDTRLanczosGBidiag bidiag;
 
   PetscFunctionBegin;
@@ -1719,12 +2052,18 @@ static PetscErrorCode SVDSetFromOptions_TRLanczos(SVD svd,PetscOptionItems *Pets
     PetscCall(PetscOptionsBool("-svd_trlanczos_locking","Choose between locking and non-locking variants","SVDTRLanczosSetLocking",PETSC_TRUE,&lock,&flg));
     if (flg) PetscCall(SVDTRLanczosSetLocking(svd,lock));
 
+    PetscCall(PetscOptionsInt("-svd_trlanczos_block_size","Block size for the block bidiagonalization","SVDTRLanczosSetBlockSize",lanczos->bs,&bs,&flg));
+    if (flg) PetscCall(SVDTRLanczosSetBlockSize(svd,bs));
+
     PetscCall(PetscOptionsEnum("-svd_trlanczos_gbidiag","Bidiagonalization choice for Generalized Problem","SVDTRLanczosSetGBidiag",SVDTRLanczosGBidiags,(PetscEnum)lanczos->bidiag,(PetscEnum*)&bidiag,&flg));
     if (flg) PetscCall(SVDTRLanczosSetGBidiag(svd,bidiag));
 
     PetscCall(PetscOptionsBool("-svd_trlanczos_explicitmatrix","Build explicit matrix for KSP solver","SVDTRLanczosSetExplicitMatrix",lanczos->explicitmatrix,&val,&flg));
     if (flg) PetscCall(SVDTRLanczosSetExplicitMatrix(svd,val));
 
+    PetscCall(PetscOptionsBool("-svd_trlanczos_inexact","Adapt the tolerance of the inner least-squares solves","SVDTRLanczosSetInexact",lanczos->inexact,&val,&flg));
+    if (flg) PetscCall(SVDTRLanczosSetInexact(svd,val));
+
     PetscCall(SVDTRLanczosGetScale(svd,&scale));
     PetscCall(PetscOptionsReal("-svd_trlanczos_scale","Scale parameter for matrix B","SVDTRLanczosSetScale",scale,&scale,&flg));
     if (flg) PetscCall(SVDTRLanczosSetScale(svd,scale));
@@ -1955,7 +2294,7 @@ static PetscErrorCode SVDTRLanczosGetKSP_TRLanczos(SVD svd,KSP *ksp)
     PetscCall(PCSetType(pc,PCNONE));
     PetscCall(KSPSetErrorIfNotConverged(ctx->ksp,PETSC_TRUE));
     PetscCall(KSPSetTolerances(ctx->ksp,SlepcDefaultTol(svd->tol)/10.0,PETSC_CURRENT,PETSC_CURRENT,PETSC_CURRENT));
-  }
+  } else PetscCall(SVDLanczosGRestoreInnerTol(svd));
   *ksp = ctx->ksp;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -2137,6 +2476,96 @@ PetscErrorCode SVDTRLanczosGetLocking(SVD svd,PetscBool *lock)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDTRLanczosSetBlockSize_TRLanczos(SVD svd,PetscInt bs)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  if (bs == PETSC_DEFAULT || bs == PETSC_DECIDE) bs = 1;
+  else PetscCheck(bs>0,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_OUTOFRANGE,"Invalid block size value");
+  if (lanczos->bs != bs) {
+    lanczos->bs = bs;
+    svd->state  = SVD_STATE_INITIAL;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosSetBlockSize - Sets the block size of the block variant of the
+   thick-restart Lanczos bidiagonalization.
+
+   Logically Collective
+
+   Input Parameters:
++  svd - the singular value solver context
+-  bs  - the block size
+
+   Options Database Key:
+.  -svd_trlanczos_block_size <bs> - Sets the block size
+
+   Notes:
+   With bs>1, each step of the bidiagonalization multiplies a block of bs
+   vectors by A and by A^T, which can be done with sparse matrix times dense
+   matrix products (see BVMatMult()), and orthonormalizes the block one column
+   at a time. If a block is rank-deficient, the dependent directions are replaced
+   by random vectors. The projected matrix is block bidiagonal and it is
+   handled as a dense matrix in DSSVD. The block variant is more robust in
+   the presence of clustered or multiple singular values, and it may be faster
+   when the matrix-matrix product is much more efficient than bs matrix-vector
+   products.
+
+   The default is bs=1, i.e., the standard (non-block) variant. The block
+   variant is only available for the standard SVD, and the one-sided flag
+   (SVDTRLanczosSetOneSide()) is ignored in that case. The value of mpd must
+   be larger than bs.
+
+   Level: advanced
+
+.seealso: SVDTRLanczosGetBlockSize(), SVDSetDimensions()
+@*/
+PetscErrorCode SVDTRLanczosSetBlockSize(SVD svd,PetscInt bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveInt(svd,bs,2);
+  PetscTryMethod(svd,"SVDTRLanczosSetBlockSize_C",(SVD,PetscInt),(svd,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosGetBlockSize_TRLanczos(SVD svd,PetscInt *bs)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *bs = lanczos->bs;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosGetBlockSize - Gets the block size used in the thick-restart
+   Lanczos bidiagonalization.
+
+   Not Collective
+
+   Input Parameter:
+.  svd - the singular value solver context
+
+   Output Parameter:
+.  bs - the block size
+
+   Level: advanced
+
+.seealso: SVDTRLanczosSetBlockSize()
+@*/
+PetscErrorCode SVDTRLanczosGetBlockSize(SVD svd,PetscInt *bs)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(bs,2);
+  PetscUseMethod(svd,"SVDTRLanczosGetBlockSize_C",(SVD,PetscInt*),(svd,bs));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDTRLanczosSetExplicitMatrix_TRLanczos(SVD svd,PetscBool explicitmat)
 {
   SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
@@ -2212,6 +2641,90 @@ PetscErrorCode SVDTRLanczosGetExplicitMatrix(SVD svd,PetscBool *explicitmat)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode SVDTRLanczosSetInexact_TRLanczos(SVD svd,PetscBool inexact)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  lanczos->inexact = inexact;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosSetInexact - Indicate if the tolerance of the inner least-squares
+   solves must be adapted to the convergence of the outer iteration.
+
+   Logically Collective
+
+   Input Parameters:
++  svd     - singular value solver
+-  inexact - Boolean flag indicating if the inexact variant is used
+
+   Options Database Key:
+.  -svd_trlanczos_inexact <boolean> - Indicates the boolean flag
+
+   Notes:
+   This option is relevant for the GSVD case only.
+
+   In the inexact variant, the least-squares problems with coefficient matrix
+   Z=[A;B] are solved with the tolerance set in the KSP object until the outer
+   iteration makes progress. Then the tolerance is relaxed in inverse proportion
+   to the residual estimate of the first unconverged triplet, up to 0.01. The
+   tolerance of the KSP is restored before computing the converged right singular
+   vectors, which are obtained with a single block solve.
+
+   Since the residual estimates of the bidiagonalization do not include the error
+   of the inner solves, the true residuals of the converged triplets are computed
+   at the end, and only the leading triplets that satisfy the convergence criterion
+   are returned.
+
+   Level: advanced
+
+.seealso: SVDTRLanczosGetInexact(), SVDTRLanczosGetKSP()
+@*/
+PetscErrorCode SVDTRLanczosSetInexact(SVD svd,PetscBool inexact)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidLogicalCollectiveBool(svd,inexact,2);
+  PetscTryMethod(svd,"SVDTRLanczosSetInexact_C",(SVD,PetscBool),(svd,inexact));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode SVDTRLanczosGetInexact_TRLanczos(SVD svd,PetscBool *inexact)
+{
+  SVD_TRLANCZOS *lanczos = (SVD_TRLANCZOS*)svd->data;
+
+  PetscFunctionBegin;
+  *inexact = lanczos->inexact;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   SVDTRLanczosGetInexact - Returns the flag indicating if the tolerance of the
+   inner least-squares solves is adapted.
+
+   Not Collective
+
+   Input Parameter:
+.  svd  - singular value solver
+
+   Output Parameter:
+.  inexact - the flag
+
+   Level: advanced
+
+.seealso: SVDTRLanczosSetInexact()
+@*/
+PetscErrorCode SVDTRLanczosGetInexact(SVD svd,PetscBool *inexact)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscAssertPointer(inexact,2);
+  PetscUseMethod(svd,"SVDTRLanczosGetInexact_C",(SVD,PetscBool*),(svd,inexact));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode SVDTRLanczosSetScale_TRLanczos(SVD svd,PetscReal scale)
 {
   SVD_TRLANCZOS *ctx = (SVD_TRLANCZOS*)svd->data;
@@ -2306,6 +2819,7 @@ static PetscErrorCode SVDReset_TRLanczos(SVD svd)
 
   PetscFunctionBegin;
   if (svd->isgeneralized || (!svd->problem_type && svd->OPb)) {
+    PetscCall(SVDLanczosGRestoreInnerTol(svd));
     PetscCall(KSPReset(lanczos->ksp));
     PetscCall(MatDestroy(&lanczos->Z));
   }
@@ -2329,8 +2843,12 @@ static PetscErrorCode SVDDestroy_TRLanczos(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetRestart_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetLocking_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetLocking_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetBlockSize_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetBlockSize_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetExplicitMatrix_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetExplicitMatrix_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetInexact_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetInexact_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetScale_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetScale_C",NULL));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -2356,13 +2874,15 @@ static PetscErrorCode SVDView_TRLanczos(SVD svd,PetscViewer viewer)
       }
       PetscCall(PetscViewerASCIIPrintf(viewer,"  bidiagonalization choice: %s\n",bidiag));
       PetscCall(PetscViewerASCIIPrintf(viewer,"  %s matrix\n",lanczos->explicitmatrix?"explicit":"implicit"));
+      if (lanczos->inexact) PetscCall(PetscViewerASCIIPrintf(viewer,"  inexact least-squares solves with adaptive tolerance\n"));
       if (lanczos->scaleth==0) PetscCall(PetscViewerASCIIPrintf(viewer,"  scale factor for matrix B: %g\n",(double)lanczos->scalef));
       else PetscCall(PetscViewerASCIIPrintf(viewer,"  automatic scaling for matrix B with threshold: %g\n",(double)lanczos->scaleth));
       if (!lanczos->ksp) PetscCall(SVDTRLanczosGetKSP(svd,&lanczos->ksp));
       PetscCall(PetscViewerASCIIPushTab(viewer));
       PetscCall(KSPView(lanczos->ksp,viewer));
       PetscCall(PetscViewerASCIIPopTab(viewer));
-    } else PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
+    } else if (lanczos->bs>1) PetscCall(PetscViewerASCIIPrintf(viewer,"  block bidiagonalization with block size %" PetscInt_FMT "\n",lanczos->bs));
+    else PetscCall(PetscViewerASCIIPrintf(viewer,"  %s-sided reorthogonalization\n",lanczos->oneside? "one": "two"));
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -2388,6 +2908,7 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_TRLanczos(SVD svd)
   svd->data = (void*)ctx;
 
   ctx->lock    = PETSC_TRUE;
+  ctx->bs      = 1;
   ctx->bidiag  = SVD_TRLANCZOS_GBIDIAG_LOWER;
   ctx->scalef  = 1.0;
   ctx->scaleth = 0.0;
@@ -2411,8 +2932,12 @@ SLEPC_EXTERN PetscErrorCode SVDCreate_TRLanczos(SVD svd)
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetRestart_C",SVDTRLanczosGetRestart_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetLocking_C",SVDTRLanczosSetLocking_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetLocking_C",SVDTRLanczosGetLocking_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetBlockSize_C",SVDTRLanczosSetBlockSize_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetBlockSize_C",SVDTRLanczosGetBlockSize_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetExplicitMatrix_C",SVDTRLanczosSetExplicitMatrix_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetExplicitMatrix_C",SVDTRLanczosGetExplicitMatrix_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetInexact_C",SVDTRLanczosSetInexact_TRLanczos));
+  PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetInexact_C",SVDTRLanczosGetInexact_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosSetScale_C",SVDTRLanczosSetScale_TRLanczos));
   PetscCall(PetscObjectComposeFunction((PetscObject)svd,"SVDTRLanczosGetScale_C",SVDTRLanczosGetScale_TRLanczos));
   PetscFunctionReturn(PETSC_SUCCESS);
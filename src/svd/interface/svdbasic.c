@@ -108,6 +108,7 @@ PetscErrorCode SVDCreate(MPI_Comm comm,SVD *outsvd)
   svd->leftbasis        = PETSC_FALSE;
   svd->swapped          = PETSC_FALSE;
   svd->expltrans        = PETSC_FALSE;
+  svd->updated          = PETSC_FALSE;
   svd->nrma             = 0.0;
   svd->nrmb             = 0.0;
   svd->isgeneralized    = PETSC_FALSE;
@@ -151,6 +152,7 @@ PetscErrorCode SVDReset(SVD svd)
   PetscCall(VecDestroyVecs(svd->nworkr,&svd->workr));
   svd->nworkr = 0;
   svd->swapped = PETSC_FALSE;
+  svd->updated = PETSC_FALSE;
   svd->state = SVD_STATE_INITIAL;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -214,3 +214,19 @@ PetscErrorCode SVDSetWorkVecs(SVD svd,PetscInt nleft,PetscInt nright)
   }
   PetscFunctionReturn(PETSC_SUCCESS);
 }
+
+/*
+   SVDBlockMatMult - Computes Y = A*V for a block of vectors, with AT the
+   (Hermitian) transpose of A. If A is a virtual Hermitian transpose, then
+   BVMatMult() will fail if PRODUCT_AhB is not implemented, so AT is used.
+*/
+PetscErrorCode SVDBlockMatMult(BV V,Mat A,BV Y,Mat AT)
+{
+  PetscBool flg=PETSC_FALSE;
+
+  PetscFunctionBegin;
+  if (PetscDefined(USE_COMPLEX)) PetscCall(PetscObjectTypeCompare((PetscObject)A,MATHERMITIANTRANSPOSEVIRTUAL,&flg));
+  if (flg) PetscCall(BVMatMultHermitianTranspose(V,AT,Y));
+  else PetscCall(BVMatMult(V,A,Y));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
@@ -194,6 +194,11 @@ PetscErrorCode SVDGetTolerances(SVD svd,PetscReal *tol,PetscInt *maxits)
    of ncv to be larger than the estimated number of singular values, to minimize
    the number of reallocations.
 
+   The basis is also enlarged before all wanted singular values have converged when
+   the smallest approximate singular value in the subspace is still above the
+   threshold. The storage grows geometrically, so the final memory is within a
+   factor two of what the number of computed singular values requires.
+
    This functionality is most useful when computing largest singular values. A
    typical use case is to compute a low rank approximation of a matrix. Suppose
    we know that singular values decay abruptly around a certain index k, which
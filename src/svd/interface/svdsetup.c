@@ -575,18 +575,29 @@ PetscErrorCode SVDAllocateSolution(SVD svd,PetscInt extra)
    This is called during the iteration in case the threshold stopping test has
    been selected.
 
+   The storage grows geometrically, i.e., at least twice the current size is
+   allocated (without exceeding the maximum number of singular values plus one),
+   so that a basis that grows in small steps is reallocated only a few times.
+
    Level: developer
 
 .seealso: SVDAllocateSolution(), SVDSetThreshold()
 @*/
 PetscErrorCode SVDReallocateSolution(SVD svd,PetscInt newsize)
 {
-  PetscInt  oldsize,*nperm;
+  PetscInt  oldsize,*nperm,M,N,P,maxsize;
   PetscReal *nsigma,*nerrest,*nsign;
 
   PetscFunctionBegin;
   PetscCall(BVGetSizes(svd->V,NULL,NULL,&oldsize));
   if (oldsize>=newsize) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscCall(MatGetSize(svd->OP,&M,&N));
+  maxsize = PetscMin(M,N);
+  if (svd->isgeneralized) {
+    PetscCall(MatGetSize(svd->OPb,&P,NULL));
+    maxsize = PetscMin(maxsize,P);
+  }
+  newsize = PetscMax(newsize,PetscMin(2*oldsize,maxsize+1));
   PetscCall(PetscInfo(svd,"Reallocating basis vectors to %" PetscInt_FMT " columns\n",newsize));
 
   /* reallocate sigma */
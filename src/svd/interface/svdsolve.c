@@ -119,6 +119,10 @@ PetscErrorCode SVDSolve(SVD svd)
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  if (svd->updated) {  /* the solver was not set up for the matrix given in SVDUpdate() */
+    svd->updated = PETSC_FALSE;
+    svd->state   = SVD_STATE_INITIAL;
+  }
   if (svd->state>=SVD_STATE_SOLVED) PetscFunctionReturn(PETSC_SUCCESS);
   PetscCall(PetscLogEventBegin(SVD_Solve,svd,0,0,0));
 
@@ -337,6 +341,242 @@ PetscErrorCode SVDGetSingularTriplet(SVD svd,PetscInt i,PetscReal *sigma,Vec u,V
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   SVDUpdate - Updates the computed singular triplets after appending new columns
+   or new rows to the matrix, without solving the problem from scratch.
+
+   Collective
+
+   Input Parameters:
++  svd - singular value solver context
+.  A   - the enlarged matrix
+-  W   - dense matrix containing the appended data
+
+   Notes:
+   SVDSolve() must have been called before. Matrix A must be equal to the matrix
+   passed in SVDSetOperators() with c columns appended at the right, or with c rows
+   appended at the bottom, keeping the same local size in the dimension that does
+   not change. In the first case, W is a dense matrix with the new columns, of
+   size M x c. In the second case, W is a dense matrix of size N x c containing
+   the conjugate transpose of the new rows. The local row size of W must match
+   the local size of the corresponding dimension of A.
+
+   The first k=min(nconv,nsv) singular triplets are updated as in Brand's method.
+   The appended data is orthogonalized against the current singular vectors, and
+   the SVD of a small (k+c)x(k+c) matrix is computed with a DS object. Hence the
+   cost depends on k and c only, and A is not accessed at all. On output, A is set
+   as the new matrix of the SVD object and the updated triplets can be retrieved
+   with SVDGetSingularTriplet(). Since the triplets not computed in the previous
+   solve are discarded, the result is an approximation of the truncated SVD of A,
+   whose accuracy can be checked with SVDComputeError(). A subsequent call to
+   SVDSolve() sets up the solver again and solves the problem with A from scratch.
+
+   This function can be called repeatedly, and is only available for standard
+   problems where the largest singular values have been computed.
+
+   Level: advanced
+
+.seealso: SVDSolve(), SVDGetSingularTriplet(), SVDSetOperators()
+@*/
+PetscErrorCode SVDUpdate(SVD svd,Mat A,Mat W)
+{
+  PetscInt           M0,N0,m0,n0,M,N,m,n,Mw,Nw,mw,G0,c,k,i,j,ld,ncols,low,high;
+  PetscBool          addcols,flg;
+  BV                 X0,Y0,X,Y,Xn,Yn,bv[2];
+  Mat                R,Q;
+  DS                 ds;
+  SlepcSC            sc;
+  Vec                x,y,t[2];
+  IS                 is;
+  VecScatter         scat;
+  PetscScalar        *pA,*pV,*py,*w;
+  const PetscScalar  *pR;
+  BVOrthogType       otype;
+  BVOrthogRefineType orefine;
+  BVOrthogBlockType  oblock;
+  PetscReal          oeta;
+
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(svd,SVD_CLASSID,1);
+  PetscValidHeaderSpecific(A,MAT_CLASSID,2);
+  PetscValidHeaderSpecific(W,MAT_CLASSID,3);
+  PetscCheckSameComm(svd,1,A,2);
+  PetscCheckSameComm(svd,1,W,3);
+  SVDCheckSolved(svd,1);
+  PetscCheck(svd->problem_type==SVD_STANDARD,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Only available for standard SVD problems");
+  PetscCheck(svd->which==SVD_LARGEST,PetscObjectComm((PetscObject)svd),PETSC_ERR_SUP,"Only available when computing the largest singular values");
+  k = PetscMin(svd->nconv,svd->nsv);
+  PetscCheck(k>0,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_WRONGSTATE,"There are no converged singular triplets to update");
+
+  /* check dimensions */
+  PetscCall(MatGetSize(svd->OP,&M0,&N0));
+  PetscCall(MatGetLocalSize(svd->OP,&m0,&n0));
+  PetscCall(MatGetSize(A,&M,&N));
+  PetscCall(MatGetLocalSize(A,&m,&n));
+  addcols = (M==M0 && N>N0)? PETSC_TRUE: PETSC_FALSE;
+  PetscCheck(addcols || (N==N0 && M>M0),PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"The new matrix must have the same rows and more columns, or the same columns and more rows");
+  PetscCheck(addcols? m==m0: n==n0,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"The local size of the dimension that does not change must be kept");
+  c  = addcols? N-N0: M-M0;
+  G0 = addcols? N0: M0;
+  PetscCall(MatGetSize(W,&Mw,&Nw));
+  PetscCall(MatGetLocalSize(W,&mw,NULL));
+  PetscCheck(Mw==(addcols?M0:N0) && Nw==c,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"Matrix W has wrong dimensions %" PetscInt_FMT "x%" PetscInt_FMT,Mw,Nw);
+  PetscCheck(mw==(addcols?m0:n0),PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_SIZ,"Matrix W has wrong local row size %" PetscInt_FMT,mw);
+  PetscCheck(k+c<=Mw,PetscObjectComm((PetscObject)svd),PETSC_ERR_ARG_OUTOFRANGE,"The number of appended vectors is too large");
+
+  /* X0 is the basis in the space of the appended data, Y0 is the one whose dimension grows */
+  PetscCall(SVDComputeVectors(svd));
+  if (addcols == !svd->swapped) { X0 = svd->U; Y0 = svd->V; }
+  else { X0 = svd->V; Y0 = svd->U; }
+
+  /* X = [X0 W], Y = Y0, with columns in the order of the singular values */
+  PetscCall(BVDuplicateResize(X0,k+c,&X));
+  PetscCall(BVDuplicateResize(Y0,k,&Y));
+  for (i=0;i<k;i++) {
+    PetscCall(BVGetColumn(X,i,&x));
+    PetscCall(BVCopyVec(X0,svd->perm[i],x));
+    PetscCall(BVRestoreColumn(X,i,&x));
+    PetscCall(BVGetColumn(Y,i,&y));
+    PetscCall(BVCopyVec(Y0,svd->perm[i],y));
+    PetscCall(BVRestoreColumn(Y,i,&y));
+  }
+  for (j=0;j<c;j++) {
+    PetscCall(MatDenseGetColumnVecRead(W,j,&x));
+    PetscCall(BVInsertVec(X,k+j,x));
+    PetscCall(MatDenseRestoreColumnVecRead(W,j,&x));
+  }
+
+  /* orthogonalize the new data against the current singular vectors, [X0 W] = X*R */
+  PetscCall(MatCreateSeqDense(PETSC_COMM_SELF,k+c,k+c,NULL,&R));
+  PetscCall(BVSetActiveColumns(X,k,k+c));
+  PetscCall(BVOrthogonalize(X,R));
+  PetscCall(BVSetActiveColumns(X,0,k+c));
+
+  /* SVD of the core matrix K = [S R12; 0 R22] */
+  PetscCall(DSCreate(PetscObjectComm((PetscObject)svd),&ds));
+  PetscCall(DSSetType(ds,DSSVD));
+  PetscCall(DSAllocate(ds,k+c));
+  PetscCall(DSGetLeadingDimension(ds,&ld));
+  PetscCall(DSSetDimensions(ds,k+c,0,0));
+  PetscCall(DSSVDSetDimensions(ds,k+c));
+  PetscCall(DSGetArray(ds,DS_MAT_A,&pA));
+  PetscCall(MatDenseGetArrayRead(R,&pR));
+  for (j=0;j<k+c;j++) {
+    for (i=0;i<k+c;i++) {
+      if (j<k) pA[i+j*ld] = (i==j)? svd->sigma[svd->perm[i]]: 0.0;
+      else pA[i+j*ld] = pR[i+j*(k+c)];
+    }
+  }
+  PetscCall(MatDenseRestoreArrayRead(R,&pR));
+  PetscCall(DSRestoreArray(ds,DS_MAT_A,&pA));
+  PetscCall(MatDestroy(&R));
+  PetscCall(DSSetState(ds,DS_STATE_RAW));
+  PetscCall(DSGetSlepcSC(ds,&sc));
+  sc->comparison    = SlepcCompareLargestReal;
+  sc->comparisonctx = NULL;
+  sc->map           = NULL;
+  sc->mapobj        = NULL;
+  sc->rg            = NULL;
+  PetscCall(PetscMalloc1(k+c,&w));
+  PetscCall(DSSolve(ds,w,NULL));
+  PetscCall(DSSort(ds,w,NULL,NULL,NULL,NULL));
+  PetscCall(DSSynchronize(ds,w,NULL));
+
+  /* rotate the bases, X = X*U(:,0:k-1) and Y = Y*V(0:k-1,0:k-1) */
+  PetscCall(DSGetMat(ds,DS_MAT_U,&Q));
+  PetscCall(BVMultInPlace(X,Q,0,k));
+  PetscCall(DSRestoreMat(ds,DS_MAT_U,&Q));
+  PetscCall(DSGetMat(ds,DS_MAT_V,&Q));
+  PetscCall(BVMultInPlace(Y,Q,0,k));
+  PetscCall(DSRestoreMat(ds,DS_MAT_V,&Q));
+
+  /* create the new bases with the layout of A */
+  PetscCall(BVGetSizes(svd->V,NULL,NULL,&ncols));
+  PetscCall(BVGetOrthogonalization(svd->V,&otype,&orefine,&oeta,&oblock));
+  PetscCall(MatCreateVecs(A,&t[1],&t[0]));
+  for (i=0;i<2;i++) {
+    PetscCall(BVCreate(PetscObjectComm((PetscObject)svd),&bv[i]));
+    PetscCall(PetscObjectIncrementTabLevel((PetscObject)bv[i],(PetscObject)svd,0));
+    PetscCall(PetscObjectSetOptions((PetscObject)bv[i],((PetscObject)svd)->options));
+    PetscCall(BVSetType(bv[i],((PetscObject)svd->V)->type_name));
+    PetscCall(BVSetSizesFromVec(bv[i],t[i],ncols));
+    PetscCall(BVSetOrthogonalization(bv[i],otype,orefine,oeta,oblock));
+  }
+  Xn = addcols? bv[0]: bv[1];  /* bv[0] is the left basis, bv[1] the right one */
+  Yn = addcols? bv[1]: bv[0];
+  for (i=0;i<k;i++) {
+    PetscCall(BVGetColumn(Xn,i,&x));
+    PetscCall(BVCopyVec(X,i,x));
+    PetscCall(BVRestoreColumn(Xn,i,&x));
+  }
+
+  /* the first G0 entries of the new Y come from Y, the last c ones from the core SVD */
+  PetscCall(BVCreateVec(Y,&y));
+  PetscCall(VecGetOwnershipRange(y,&low,&high));
+  PetscCall(ISCreateStride(PetscObjectComm((PetscObject)svd),high-low,low,1,&is));
+  x = addcols? t[1]: t[0];
+  PetscCall(VecScatterCreate(y,is,x,is,&scat));
+  PetscCall(VecGetOwnershipRange(x,&low,&high));
+  PetscCall(VecDestroy(&y));
+  PetscCall(ISDestroy(&is));
+  PetscCall(DSGetArray(ds,DS_MAT_V,&pV));
+  for (i=0;i<k;i++) {
+    PetscCall(BVGetColumn(Y,i,&y));
+    PetscCall(BVGetColumn(Yn,i,&x));
+    PetscCall(VecScatterBegin(scat,y,x,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecScatterEnd(scat,y,x,INSERT_VALUES,SCATTER_FORWARD));
+    PetscCall(VecGetArray(x,&py));
+    for (j=PetscMax(low,G0);j<high;j++) py[j-low] = pV[k+j-G0+i*ld];
+    PetscCall(VecRestoreArray(x,&py));
+    PetscCall(BVRestoreColumn(Yn,i,&x));
+    PetscCall(BVRestoreColumn(Y,i,&y));
+  }
+  PetscCall(DSRestoreArray(ds,DS_MAT_V,&pV));
+  PetscCall(VecScatterDestroy(&scat));
+  PetscCall(VecDestroy(&t[0]));
+  PetscCall(VecDestroy(&t[1]));
+  PetscCall(BVDestroy(&X));
+  PetscCall(BVDestroy(&Y));
+  PetscCall(DSDestroy(&ds));
+
+  /* replace the matrix, this resets the solver */
+  PetscCall(SVDSetOperators(svd,A,NULL));
+  PetscCall(BVDestroy(&svd->U));
+  PetscCall(BVDestroy(&svd->V));
+  PetscCall(MatDestroy(&svd->A));
+  PetscCall(MatDestroy(&svd->AT));
+  PetscCall(PetscObjectReference((PetscObject)A));
+  if (svd->expltrans) {  /* as in SVDSetUp(), if the previous setup built the transpose */
+    PetscCall(MatHasOperation(A,MATOP_TRANSPOSE,&flg));
+    svd->expltrans = (!svd->impltrans && flg)? PETSC_TRUE: PETSC_FALSE;
+  }
+  if (M>=N) {
+    svd->A = A;
+    if (svd->expltrans) PetscCall(MatHermitianTranspose(A,MAT_INITIAL_MATRIX,&svd->AT));
+    else PetscCall(MatCreateHermitianTranspose(A,&svd->AT));
+    svd->U = bv[0];
+    svd->V = bv[1];
+    svd->swapped = PETSC_FALSE;
+  } else {
+    if (svd->expltrans) PetscCall(MatHermitianTranspose(A,MAT_INITIAL_MATRIX,&svd->A));
+    else PetscCall(MatCreateHermitianTranspose(A,&svd->A));
+    svd->AT = A;
+    svd->U = bv[1];
+    svd->V = bv[0];
+    svd->swapped = PETSC_TRUE;
+  }
+  for (i=0;i<k;i++) {
+    svd->sigma[i]  = PetscRealPart(w[i]);
+    svd->errest[i] = 0.0;
+    svd->perm[i]   = i;
+  }
+  PetscCall(PetscFree(w));
+  svd->nconv   = k;
+  svd->state   = SVD_STATE_VECTORS;
+  svd->updated = PETSC_TRUE;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*
    SVDComputeResidualNorms_Standard - Computes the norms of the left and
    right residuals associated with the i-th computed singular triplet.
@@ -378,7 +618,7 @@ static PetscErrorCode SVDComputeResidualNorms_Standard(SVD svd,PetscReal sigma,V
      x     - right singular vector
      y,z   - two work vectors with the same dimension as x
 */
-static PetscErrorCode SVDComputeResidualNorms_Generalized(SVD svd,PetscReal sigma,Vec uv,Vec x,Vec y,Vec z,PetscReal *norm1,PetscReal *norm2)
+PetscErrorCode SVDComputeResidualNorms_Generalized(SVD svd,PetscReal sigma,Vec uv,Vec x,Vec y,Vec z,PetscReal *norm1,PetscReal *norm2)
 {
   Vec            u,v,ax,bx,nest,aux[2];
   PetscReal      c,s;
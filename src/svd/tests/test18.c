@@ -123,6 +123,10 @@ int main(int argc,char **argv)
          suffix: 1_trlanczos
          args: -svd_type trlanczos -svd_trlanczos_gbidiag {{single upper lower}}
          requires: !__float128
+      test:
+         suffix: 1_trlanczos_inexact
+         args: -svd_type trlanczos -svd_trlanczos_gbidiag {{single lower}} -svd_trlanczos_inexact
+         requires: double
 
    test:
       suffix: 2
@@ -0,0 +1,193 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests SVDUpdate after appending columns or rows to the matrix.\n\n"
+  "The command line options are:\n"
+  "  -m <m>, where <m> = matrix rows.\n"
+  "  -n <n>, where <n> = matrix columns.\n"
+  "  -c <c>, where <c> = number of appended columns.\n"
+  "  -rows, to work with the transpose, i.e., append rows instead of columns.\n"
+  "  -random, to append dense random data instead of continuing the diagonal.\n\n";
+
+#include <slepcsvd.h>
+
+/*
+   The matrix is a rectangular diagonal matrix with entries 1,2,...,min(m,n). The
+   appended data continues the diagonal, so the largest singular values of the
+   enlarged matrix are known. With -random the appended data is a dense random
+   matrix, and the updated triplets are compared with a new solve from scratch
+   (they coincide if all the singular triplets of the original matrix are kept).
+ */
+
+static PetscErrorCode BuildDiagonal(PetscInt m,PetscInt n,Mat *A)
+{
+  PetscInt Istart,Iend,i;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatCreate(PETSC_COMM_WORLD,A));
+  PetscCall(MatSetSizes(*A,PETSC_DECIDE,PETSC_DECIDE,m,n));
+  PetscCall(MatSetFromOptions(*A));
+  PetscCall(MatGetOwnershipRange(*A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) if (i<n) PetscCall(MatSetValue(*A,i,i,i+1,INSERT_VALUES));
+  PetscCall(MatAssemblyBegin(*A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(*A,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Inserts the random data of W in the enlarged matrix A1, as columns n,n+1,... or
+   as rows n,n+1,... (conjugate transpose of W)
+ */
+static PetscErrorCode AppendData(Mat A1,PetscInt n,PetscBool rows,Mat W)
+{
+  PetscInt          Istart,Iend,i,j,c;
+  const PetscScalar *pW;
+
+  PetscFunctionBeginUser;
+  PetscCall(MatGetSize(W,NULL,&c));
+  PetscCall(MatGetOwnershipRange(W,&Istart,&Iend));
+  PetscCall(MatSetOption(A1,MAT_NEW_NONZERO_ALLOCATION_ERR,PETSC_FALSE));
+  PetscCall(MatDenseGetArrayRead(W,&pW));
+  for (j=0;j<c;j++) {
+    for (i=Istart;i<Iend;i++) {
+      if (rows) PetscCall(MatSetValue(A1,n+j,i,PetscConj(pW[i-Istart+j*(Iend-Istart)]),INSERT_VALUES));
+      else PetscCall(MatSetValue(A1,i,n+j,pW[i-Istart+j*(Iend-Istart)],INSERT_VALUES));
+    }
+  }
+  PetscCall(MatDenseRestoreArrayRead(W,&pW));
+  PetscCall(MatAssemblyBegin(A1,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A1,MAT_FINAL_ASSEMBLY));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+int main(int argc,char **argv)
+{
+  Mat            A,A1,W;
+  SVD            svd;
+  PetscRandom    rand;
+  PetscInt       m=30,n=20,c=3,mw,Istart,Iend,i,j,k,nsv,nconv;
+  PetscScalar    *pW;
+  PetscReal      sigma,*sigmaup,tol,err,maxerr=0.0,maxdif=0.0;
+  PetscBool      rows,random;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-c",&c,NULL));
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-rows",&rows));
+  PetscCall(PetscOptionsHasName(NULL,NULL,"-random",&random));
+  PetscCheck(n+c<=m,PETSC_COMM_WORLD,PETSC_ERR_USER_INPUT,"The value of n+c must not be larger than m");
+  if (rows) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nDiagonal matrix, size %" PetscInt_FMT "x%" PetscInt_FMT ", appending %" PetscInt_FMT " rows\n\n",n,m,c));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nDiagonal matrix, size %" PetscInt_FMT "x%" PetscInt_FMT ", appending %" PetscInt_FMT " columns\n\n",m,n,c));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+             Compute singular values of the original matrix
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  if (rows) PetscCall(BuildDiagonal(n,m,&A));
+  else PetscCall(BuildDiagonal(m,n,&A));
+  PetscCall(SVDCreate(PETSC_COMM_WORLD,&svd));
+  PetscCall(SVDSetOperators(svd,A,NULL));
+  PetscCall(SVDSetDimensions(svd,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(SVDSetFromOptions(svd));
+  PetscCall(SVDSolve(svd));
+  PetscCall(SVDErrorView(svd,SVD_ERROR_RELATIVE,NULL));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+       Update with the enlarged matrix, W contains the appended data
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+
+  if (rows) {
+    PetscCall(BuildDiagonal(n+c,m,&A1));
+    PetscCall(MatGetLocalSize(A1,NULL,&mw));
+  } else {
+    PetscCall(BuildDiagonal(m,n+c,&A1));
+    PetscCall(MatGetLocalSize(A1,&mw,NULL));
+  }
+  PetscCall(MatCreateDense(PETSC_COMM_WORLD,mw,PETSC_DECIDE,m,c,NULL,&W));
+  PetscCall(MatGetOwnershipRange(W,&Istart,&Iend));
+  if (random) {
+    PetscCall(PetscRandomCreate(PETSC_COMM_WORLD,&rand));
+    PetscCall(PetscRandomSetFromOptions(rand));
+    PetscCall(MatDenseGetArrayWrite(W,&pW));
+    for (j=0;j<c;j++) for (i=0;i<Iend-Istart;i++) PetscCall(PetscRandomGetValue(rand,pW+i+j*(Iend-Istart)));
+    PetscCall(MatDenseRestoreArrayWrite(W,&pW));
+    PetscCall(PetscRandomDestroy(&rand));
+  } else {
+    for (i=0;i<c;i++) if (n+i>=Istart && n+i<Iend) PetscCall(MatSetValue(W,n+i,i,n+i+1,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(W,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(W,MAT_FINAL_ASSEMBLY));
+
+  if (random) PetscCall(AppendData(A1,n,rows,W));
+
+  PetscCall(SVDUpdate(svd,A1,W));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"After the update:\n"));
+  if (!random) PetscCall(SVDErrorView(svd,SVD_ERROR_RELATIVE,NULL));
+  else {
+    /* check the residuals of the updated triplets */
+    PetscCall(SVDGetDimensions(svd,&nsv,NULL,NULL));
+    PetscCall(SVDGetTolerances(svd,&tol,NULL));
+    PetscCall(SVDGetConverged(svd,&nconv));
+    k = PetscMin(nsv,nconv);
+    PetscCall(PetscMalloc1(k,&sigmaup));
+    for (i=0;i<k;i++) {
+      PetscCall(SVDGetSingularTriplet(svd,i,&sigmaup[i],NULL,NULL));
+      PetscCall(SVDComputeError(svd,i,SVD_ERROR_RELATIVE,&err));
+      maxerr = PetscMax(maxerr,err);
+    }
+    if (maxerr<5.0*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD," Relative errors of the %" PetscInt_FMT " updated triplets below the tolerance\n",k));
+    else PetscCall(PetscPrintf(PETSC_COMM_WORLD," Relative errors of the updated triplets up to %g\n",(double)maxerr));
+
+    /* SVDSolve() after SVDUpdate() sets up the solver again and solves from scratch */
+    PetscCall(SVDSolve(svd));
+    PetscCall(SVDGetConverged(svd,&nconv));
+    PetscCheck(nconv>=k,PETSC_COMM_WORLD,PETSC_ERR_CONV_FAILED,"The new solve computed only %" PetscInt_FMT " singular values",nconv);
+    for (i=0;i<k;i++) {
+      PetscCall(SVDGetSingularTriplet(svd,i,&sigma,NULL,NULL));
+      maxdif = PetscMax(maxdif,PetscAbsReal(sigma-sigmaup[i])/sigma);
+    }
+    if (maxdif<5.0*tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD," Updated singular values agree with a new solve\n\n"));
+    else PetscCall(PetscPrintf(PETSC_COMM_WORLD," Updated singular values differ from a new solve by %g\n\n",(double)maxdif));
+    PetscCall(PetscFree(sigmaup));
+  }
+
+  PetscCall(SVDDestroy(&svd));
+  PetscCall(MatDestroy(&A));
+  PetscCall(MatDestroy(&A1));
+  PetscCall(MatDestroy(&W));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      args: -svd_type {{lapack cross trlanczos}}
+      requires: !single
+      test:
+         suffix: 1
+      test:
+         suffix: 2
+         nsize: 2
+         args: -rows
+
+   testset:
+      args: -svd_type {{lapack cross trlanczos}} -random -n 8 -c 2 -svd_nsv 8
+      requires: !single
+      test:
+         suffix: 3
+      test:
+         suffix: 4
+         nsize: 2
+         args: -rows
+
+TEST*/
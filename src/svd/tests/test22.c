@@ -0,0 +1,91 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Tests the block variant of SVDTRLANCZOS with a rank-deficient block.\n\n"
+  "The command line options are:\n"
+  "  -n <n>, where <n> = matrix dimension.\n\n";
+
+#include <slepcsvd.h>
+
+/*
+   The matrix is upper bidiagonal with diagonal 3,4,...,n (starting at row 2) and
+   unit superdiagonal, except that its first two columns are both equal to e_0.
+   The initial right vectors are e_0 and e_1, so the first block A*[e_0 e_1] is
+   rank-deficient and the solver must replace the dependent direction.
+ */
+
+int main(int argc,char **argv)
+{
+  Mat            A;
+  SVD            svd;
+  Vec            v[2];
+  PetscInt       n=20,i,Istart,Iend;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nMatrix with two equal columns, n=%" PetscInt_FMT "\n\n",n));
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(A));
+  PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i==0) {
+      PetscCall(MatSetValue(A,0,0,1.0,INSERT_VALUES));
+      PetscCall(MatSetValue(A,0,1,1.0,INSERT_VALUES));
+    } else {
+      if (i>1) PetscCall(MatSetValue(A,i,i,i+1,INSERT_VALUES));
+      if (i<n-1) PetscCall(MatSetValue(A,i,i+1,1.0,INSERT_VALUES));
+    }
+  }
+  PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(A,MAT_FINAL_ASSEMBLY));
+
+  /* initial right vectors e_0 and e_1 */
+  PetscCall(MatCreateVecs(A,&v[0],NULL));
+  PetscCall(VecDuplicate(v[0],&v[1]));
+  for (i=0;i<2;i++) {
+    PetscCall(VecSet(v[i],0.0));
+    PetscCall(VecSetValue(v[i],i,1.0,INSERT_VALUES));
+    PetscCall(VecAssemblyBegin(v[i]));
+    PetscCall(VecAssemblyEnd(v[i]));
+  }
+
+  PetscCall(SVDCreate(PETSC_COMM_WORLD,&svd));
+  PetscCall(SVDSetOperators(svd,A,NULL));
+  PetscCall(SVDSetType(svd,SVDTRLANCZOS));
+  PetscCall(SVDTRLanczosSetBlockSize(svd,2));
+  PetscCall(SVDSetDimensions(svd,4,PETSC_DETERMINE,PETSC_DETERMINE));
+  PetscCall(SVDSetFromOptions(svd));
+  PetscCall(SVDSetInitialSpaces(svd,2,v,0,NULL));
+  PetscCall(SVDSolve(svd));
+  PetscCall(SVDErrorView(svd,SVD_ERROR_RELATIVE,NULL));
+
+  PetscCall(VecDestroy(&v[0]));
+  PetscCall(VecDestroy(&v[1]));
+  PetscCall(SVDDestroy(&svd));
+  PetscCall(MatDestroy(&A));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      requires: !single
+      output_file: output/test22_1.out
+      test:
+         suffix: 1
+      test:
+         suffix: 2
+         nsize: 2
+
+TEST*/
@@ -164,6 +164,18 @@ int main(int argc,char **argv)
          args: -svd_type primme
          requires: primme
 
+   test:
+      suffix: 1_trlanczos_block
+      args: -svd_nsv 4 -svd_type trlanczos -svd_trlanczos_block_size 3 -svd_view
+      filter: grep -e "block bidiagonalization" -e "^SVD of" -e "^ All requested" -e "^     [0-9]" -e "^Level" | sed -e "s/^ *block/block/" | sed -e "s/22176/22175/" | sed -e "s/21798/21797/" | sed -e "s/16826/16825/" | sed -e "s/15129/15128/" | sed -e "s/22200/22201/"
+      output_file: output/test3_1_trlanczos_block.out
+
+   test:
+      suffix: 1_cyclic_structured
+      args: -svd_nsv 4 -svd_type cyclic -svd_cyclic_structured -svd_view
+      filter: grep -e "structured variant" -e "^SVD of" -e "^ All requested" -e "^     [0-9]" -e "^Level" | sed -e "s/^ *structured/structured/" | sed -e "s/22176/22175/" | sed -e "s/21798/21797/" | sed -e "s/16826/16825/" | sed -e "s/15129/15128/" | sed -e "s/22200/22201/"
+      output_file: output/test3_1_cyclic_structured.out
+
    testset:
       args: -svd_implicittranspose -svd_nsv 4 -svd_tol 1e-5
       output_file: output/test3_1.out
@@ -204,6 +216,25 @@ int main(int argc,char **argv)
          suffix: 2_randomized
          args: -svd_type randomized
 
+   testset:
+      args: -svd_implicittranspose -svd_nsv 4 -svd_tol 1e-5 -svd_type cross -svd_cross_fused_product -svd_view
+      output_file: output/test3_2_cross_fused.out
+      filter: grep -e "fused kernel" -e "^ *type: subspace" -e "^ All requested" -e "^     [0-9]" | sed -e "s/^ *using/using/" -e "s/^ *type:/type:/" | sed -e "s/22176/22175/" | sed -e "s/21798/21797/" | sed -e "s/16826/16825/" | sed -e "s/15129/15128/" | sed -e "s/22200/22201/"
+      test:
+         suffix: 2_cross_fused
+      test:
+         suffix: 2_cross_fused_par
+         nsize: 2
+      test:
+         suffix: 2_cross_fused_matmult
+         args: -svd_cross_eps_type subspace -svd_cross_bv_matmult mat
+         output_file: output/test3_2_cross_fused_matmult.out
+      test:
+         suffix: 2_cross_fused_matmult_par
+         nsize: 2
+         args: -svd_cross_eps_type subspace -svd_cross_bv_matmult mat
+         output_file: output/test3_2_cross_fused_matmult.out
+
    testset:
       args: -svd_nsv 4 -mat_type aijcusparse
       requires: cuda
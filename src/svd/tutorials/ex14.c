@@ -124,6 +124,10 @@ int main(int argc,char **argv)
          nsize: {{1 2 3}}
          args: -svd_nsv 4 -svd_type scalapack
          requires: scalapack
+      test:
+         suffix: 1_lapack_distributed
+         nsize: {{1 2 3}}
+         args: -svd_nsv 4 -svd_type lapack -ds_parallel distributed
       test:
          suffix: 1_elemental
          nsize: {{1 2 3}}
@@ -192,4 +196,11 @@ int main(int argc,char **argv)
          args: -file ${DATAFILESPATH}/matrices/complex/qc324.petsc -svd_threshold_relative 0.6 -svd_ncv {{18 10}}
          requires: double complex datafilespath !defined(PETSC_USE_64BIT_INDICES)
 
+   test:
+      suffix: 4_randomized
+      args: -file ${SLEPC_DIR}/share/slepc/datafiles/matrices/rdb200.petsc -svd_threshold_relative 0.9 -svd_ncv 6 -svd_type randomized -terse
+      output_file: output/ex14_4.out
+      filter: grep -v method
+      requires: double !complex !defined(PETSC_USE_64BIT_INDICES)
+
 TEST*/
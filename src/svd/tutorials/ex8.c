@@ -11,7 +11,8 @@
 static char help[] = "Estimates the 2-norm condition number of a matrix A, that is, the ratio of the largest to the smallest singular values of A. "
   "The matrix is a Grcar matrix.\n\n"
   "The command line options are:\n"
-  "  -n <n>, where <n> = matrix dimension.\n\n";
+  "  -n <n>, where <n> = matrix dimension.\n"
+  "  -m <m>, where <m> = number of rows, the Grcar matrix is stacked to fill them (default n).\n\n";
 
 #include <slepcsvd.h>
 
@@ -29,13 +30,17 @@ static char help[] = "Estimates the 2-norm condition number of a matrix A, that
               |                  -1  1  1 |
               |                     -1  1 |
 
+
+   With -m larger than n, the Grcar matrix is stacked vertically to form a tall
+   matrix of m rows, e.g., with m=k*n the singular values are those of the Grcar
+   matrix multiplied by sqrt(k).
  */
 
 int main(int argc,char **argv)
 {
   Mat            A;               /* Grcar matrix */
   SVD            svd;             /* singular value solver context */
-  PetscInt       N=30,Istart,Iend,i,col[5],nconv1,nconv2;
+  PetscInt       N=30,M,Istart,Iend,i,j,col[5],nconv1,nconv2;
   PetscScalar    value[] = { -1, 1, 1, 1, 1 };
   PetscReal      sigma_1,sigma_n;
 
@@ -43,21 +48,26 @@ int main(int argc,char **argv)
   PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
 
   PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&N,NULL));
-  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nEstimate the condition number of a Grcar matrix, n=%" PetscInt_FMT "\n\n",N));
+  M = N;
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&M,NULL));
+  PetscCheck(M>=N,PETSC_COMM_WORLD,PETSC_ERR_USER_INPUT,"The number of rows must be at least n");
+  if (M==N) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nEstimate the condition number of a Grcar matrix, n=%" PetscInt_FMT "\n\n",N));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"\nEstimate the condition number of a stacked Grcar matrix, m=%" PetscInt_FMT " n=%" PetscInt_FMT "\n\n",M,N));
 
   /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
         Generate the matrix
      - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
 
   PetscCall(MatCreate(PETSC_COMM_WORLD,&A));
-  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,N,N));
+  PetscCall(MatSetSizes(A,PETSC_DECIDE,PETSC_DECIDE,M,N));
   PetscCall(MatSetFromOptions(A));
 
   PetscCall(MatGetOwnershipRange(A,&Istart,&Iend));
   for (i=Istart;i<Iend;i++) {
-    col[0]=i-1; col[1]=i; col[2]=i+1; col[3]=i+2; col[4]=i+3;
-    if (i==0) PetscCall(MatSetValues(A,1,&i,PetscMin(4,N-i),col+1,value+1,INSERT_VALUES));
-    else PetscCall(MatSetValues(A,1,&i,PetscMin(5,N-i+1),col,value,INSERT_VALUES));
+    j = i%N;  /* row of the Grcar matrix */
+    col[0]=j-1; col[1]=j; col[2]=j+1; col[3]=j+2; col[4]=j+3;
+    if (j==0) PetscCall(MatSetValues(A,1,&i,PetscMin(4,N-j),col+1,value+1,INSERT_VALUES));
+    else PetscCall(MatSetValues(A,1,&i,PetscMin(5,N-j+1),col,value,INSERT_VALUES));
   }
 
   PetscCall(MatAssemblyBegin(A,MAT_FINAL_ASSEMBLY));
@@ -141,4 +151,15 @@ int main(int argc,char **argv)
    test:
       suffix: 1
 
+   test:
+      suffix: 2
+      args: -svd_type cross -svd_cross_sketch -svd_view
+      filter: grep -e "condition number" -e "singular values:" -e "^ *type: cg" -e "^ *type: gmres" | sed -e "s/^ *type:/type:/"
+
+   test:
+      suffix: 3
+      nsize: 2
+      args: -m 120 -svd_type cross -svd_cross_sketch -svd_cross_sketch_size 60 -svd_view
+      filter: grep -e "condition number" -e "singular values:" -e "^ *type: cg" -e "^ *type: gmres" | sed -e "s/^ *type:/type:/"
+
 TEST*/
@@ -22,6 +22,7 @@ typedef struct {
   PetscInt    d;        /* degree of the tensor BV */
   PetscInt    ld;       /* leading dimension of a single block in S */
   PetscInt    puk;      /* copy of the k value */
+  PetscReal   tol;      /* relative tolerance for the truncated SVD in compression */
   Vec         u;        /* auxiliary work vector */
 } BV_TENSOR;
 
@@ -367,35 +368,48 @@ static PetscErrorCode BVTensorCompress_Tensor(BV V,PetscInt newc)
   BV_TENSOR      *ctx = (BV_TENSOR*)V->data;
   PetscInt       nwu=0,nnc,nrow,lwa,r,c;
   PetscInt       i,j,k,n,lds=ctx->ld*ctx->d,deg=ctx->d,lock,cs1=V->k,rs1=ctx->U->k,rk=0,offu;
-  PetscScalar    *S,*M,*Z,*pQ,*SS,*SS2,t,sone=1.0,zero=0.0,mone=-1.0,*p,*tau,*work,*qB,*sqB;
-  PetscReal      *sg,tol,*rwork;
-  PetscBLASInt   ld_,cs1_,rs1_,cs1tdeg,n_,info,lw_,newc_,newctdeg,nnc_,nrow_,nnctdeg,lds_,rk_;
+  PetscScalar    *S,*M,*Z,*pQ,*SS,*SS2,t,sone=1.0,zero=0.0,mone=-1.0,*p,*tau,*work,*qB,*sqB,qwork,dummy=0.0;
+  PetscReal      *sg,tol,*rwork,rdummy=0.0;
+  PetscBLASInt   ld_,cs1_,rs1_,cs1tdeg,n_,info,lw_,newc_,newctdeg,nnc_,nrow_,nnctdeg,lds_,rk_,ncol_;
   Mat            Q,A;
 
   PetscFunctionBegin;
   if (!cs1) PetscFunctionReturn(PETSC_SUCCESS);
-  lwa = 6*ctx->ld*lds+2*cs1;
   n = PetscMin(rs1,deg*cs1);
   lock = ctx->U->l;
   nnc = cs1-lock-newc;
   nrow = rs1-lock;
-  PetscCall(PetscCalloc6(deg*newc*nnc,&SS,newc*nnc,&SS2,(rs1+lock+newc)*n,&pQ,deg*rs1,&tau,lwa,&work,6*n,&rwork));
+  PetscCall(PetscBLASIntCast(n,&n_));
+  PetscCall(PetscBLASIntCast(rs1,&rs1_));
+  PetscCall(PetscBLASIntCast(nrow,&nrow_));
+  PetscCall(PetscBLASIntCast(PetscMax(1,deg*PetscMax(newc,nnc)),&ncol_));
+
+  /* workspace query for the largest SVD, of size nrow x deg*max(newc,nnc); the work array
+     holds M (rs1 x deg*cs1), Z (deg*cs1 x n) and the maximum of that workspace and rs1*rs1 */
+  lw_ = -1;
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+#if !defined (PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgesvd",LAPACKgesvd_("S","S",&nrow_,&ncol_,&dummy,&nrow_,&rdummy,&dummy,&rs1_,&dummy,&n_,&qwork,&lw_,&info));
+#else
+  PetscCallBLAS("LAPACKgesvd",LAPACKgesvd_("S","S",&nrow_,&ncol_,&dummy,&nrow_,&rdummy,&dummy,&rs1_,&dummy,&n_,&qwork,&lw_,&rdummy,&info));
+#endif
+  SlepcCheckLapackInfo("gesvd",info);
+  PetscCall(PetscFPTrapPop());
+  lwa = rs1*cs1*deg+deg*cs1*n+PetscMax((PetscInt)PetscRealPart(qwork),rs1*rs1);
+  PetscCall(PetscCalloc6(deg*newc*nnc,&SS,newc*nnc,&SS2,(rs1+lock+newc)*n,&pQ,rs1,&tau,lwa,&work,6*n,&rwork));
   offu = lock*(rs1+1);
   M = work+nwu;
   nwu += rs1*cs1*deg;
   sg = rwork;
   Z = work+nwu;
   nwu += deg*cs1*n;
-  PetscCall(PetscBLASIntCast(n,&n_));
   PetscCall(PetscBLASIntCast(nnc,&nnc_));
   PetscCall(PetscBLASIntCast(cs1,&cs1_));
-  PetscCall(PetscBLASIntCast(rs1,&rs1_));
   PetscCall(PetscBLASIntCast(newc,&newc_));
   PetscCall(PetscBLASIntCast(newc*deg,&newctdeg));
   PetscCall(PetscBLASIntCast(nnc*deg,&nnctdeg));
   PetscCall(PetscBLASIntCast(cs1*deg,&cs1tdeg));
   PetscCall(PetscBLASIntCast(lwa-nwu,&lw_));
-  PetscCall(PetscBLASIntCast(nrow,&nrow_));
   PetscCall(PetscBLASIntCast(lds,&lds_));
   PetscCall(MatDenseGetArray(ctx->S,&S));
 
@@ -451,6 +465,7 @@ static PetscErrorCode BVTensorCompress_Tensor(BV V,PetscInt newc)
   SlepcCheckLapackInfo("gesvd",info);
   PetscCall(PetscFPTrapPop());
   tol = PetscMax(rs1,deg*cs1)*PETSC_MACHINE_EPSILON*sg[0];
+  if (ctx->tol!=(PetscReal)PETSC_DETERMINE) tol = PetscMax(tol,ctx->tol*sg[0]);
   rk = 0;
   for (i=0;i<PetscMin(nrow,nnctdeg);i++) if (sg[i]>tol) rk++;
   rk = PetscMin(nnc+deg-1,rk);
@@ -552,6 +567,7 @@ static PetscErrorCode BVTensorCompress_Tensor(BV V,PetscInt newc)
    decomposition, it is necessary to compress it in a way that fewer columns of
    U are employed. This can be achieved by means of an update that involves the
    SVD of the low-rank matrix [S_0 S_1 ... S_{d-1}], where S_i are the pieces of S.
+   The rank is determined adaptively, see BVTensorSetCompressTolerance().
 
    If newc is nonzero, then newc columns are added to the leading columns of V.
    This means that the corresponding columns of the U and S factors will remain
@@ -559,7 +575,7 @@ static PetscErrorCode BVTensorCompress_Tensor(BV V,PetscInt newc)
 
    Level: advanced
 
-.seealso: BVCreateTensor(), BVSetActiveColumns()
+.seealso: BVCreateTensor(), BVSetActiveColumns(), BVTensorSetCompressTolerance()
 @*/
 PetscErrorCode BVTensorCompress(BV V,PetscInt newc)
 {
@@ -570,6 +586,91 @@ PetscErrorCode BVTensorCompress(BV V,PetscInt newc)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode BVTensorSetCompressTolerance_Tensor(BV V,PetscReal tol)
+{
+  BV_TENSOR *ctx = (BV_TENSOR*)V->data;
+
+  PetscFunctionBegin;
+  if (tol == (PetscReal)PETSC_DEFAULT || tol == (PetscReal)PETSC_DECIDE || tol == (PetscReal)PETSC_DETERMINE) ctx->tol = PETSC_DETERMINE;
+  else {
+    PetscCheck(tol>=0.0 && tol<1.0,PetscObjectComm((PetscObject)V),PETSC_ERR_ARG_OUTOFRANGE,"Illegal value of tol. Must be in [0,1)");
+    ctx->tol = tol;
+  }
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   BVTensorSetCompressTolerance - Sets the relative tolerance used to truncate
+   the SVD when compressing the tensor BV.
+
+   Logically Collective
+
+   Input Parameters:
++  V   - the tensor basis vectors context
+-  tol - the relative tolerance
+
+   Options Database Key:
+.  -bv_tensor_compress_tol <tol> - the relative tolerance (with the prefix of U)
+
+   Notes:
+   In BVTensorCompress() the singular values of [S_0 S_1 ... S_{d-1}] that are
+   below tol times the largest singular value are discarded, so that the number
+   of columns of U (and hence the size of S) adapts to the numerical rank of
+   the basis rather than growing with the degree. By default (PETSC_DETERMINE)
+   only singular values at the level of the machine precision are discarded.
+
+   A value of tol larger than the requested tolerance of the eigensolver may
+   spoil the accuracy of the computed eigenpairs.
+
+   The option is read in BVCreateTensor() using the options prefix of U.
+
+   Level: advanced
+
+.seealso: BVTensorGetCompressTolerance(), BVTensorCompress(), BVCreateTensor()
+@*/
+PetscErrorCode BVTensorSetCompressTolerance(BV V,PetscReal tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(V,BV_CLASSID,1);
+  PetscValidLogicalCollectiveReal(V,tol,2);
+  PetscTryMethod(V,"BVTensorSetCompressTolerance_C",(BV,PetscReal),(V,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+static PetscErrorCode BVTensorGetCompressTolerance_Tensor(BV V,PetscReal *tol)
+{
+  BV_TENSOR *ctx = (BV_TENSOR*)V->data;
+
+  PetscFunctionBegin;
+  *tol = ctx->tol;
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*@
+   BVTensorGetCompressTolerance - Gets the relative tolerance used to truncate
+   the SVD when compressing the tensor BV.
+
+   Not Collective
+
+   Input Parameter:
+.  V - the tensor basis vectors context
+
+   Output Parameter:
+.  tol - the relative tolerance
+
+   Level: advanced
+
+.seealso: BVTensorSetCompressTolerance()
+@*/
+PetscErrorCode BVTensorGetCompressTolerance(BV V,PetscReal *tol)
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(V,BV_CLASSID,1);
+  PetscAssertPointer(tol,2);
+  PetscUseMethod(V,"BVTensorGetCompressTolerance_C",(BV,PetscReal*),(V,tol));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode BVTensorGetDegree_Tensor(BV bv,PetscInt *d)
 {
   BV_TENSOR *ctx = (BV_TENSOR*)bv->data;
@@ -692,6 +793,23 @@ PetscErrorCode BVTensorRestoreFactors(BV V,BV *U,Mat *S)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode BVSetFromOptions_Tensor(BV bv,PetscOptionItems *PetscOptionsObject)
+{
+  BV_TENSOR      *ctx = (BV_TENSOR*)bv->data;
+  PetscReal      tol;
+  PetscBool      flg;
+
+  PetscFunctionBegin;
+  PetscOptionsHeadBegin(PetscOptionsObject,"BV Tensor Options");
+
+    tol = ctx->tol;
+    PetscCall(PetscOptionsReal("-bv_tensor_compress_tol","Relative tolerance for the truncated SVD in compression","BVTensorSetCompressTolerance",tol,&tol,&flg));
+    if (flg) PetscCall(BVTensorSetCompressTolerance(bv,tol));
+
+  PetscOptionsHeadEnd();
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static PetscErrorCode BVDestroy_Tensor(BV bv)
 {
   BV_TENSOR      *ctx = (BV_TENSOR*)bv->data;
@@ -706,6 +824,8 @@ static PetscErrorCode BVDestroy_Tensor(BV bv)
   PetscCall(PetscFree(bv->data));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorBuildFirstColumn_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorCompress_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorSetCompressTolerance_C",NULL));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetCompressTolerance_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetDegree_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetFactors_C",NULL));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorRestoreFactors_C",NULL));
@@ -720,6 +840,7 @@ SLEPC_EXTERN PetscErrorCode BVCreate_Tensor(BV bv)
   PetscCall(PetscNew(&ctx));
   bv->data = (void*)ctx;
   ctx->puk = -1;
+  ctx->tol = PETSC_DETERMINE;
 
   bv->ops->multinplace      = BVMultInPlace_Tensor;
   bv->ops->multinplacetrans = BVMultInPlaceHermitianTranspose_Tensor;
@@ -730,9 +851,12 @@ SLEPC_EXTERN PetscErrorCode BVCreate_Tensor(BV bv)
   bv->ops->gramschmidt      = BVOrthogonalizeGS1_Tensor;
   bv->ops->destroy          = BVDestroy_Tensor;
   bv->ops->view             = BVView_Tensor;
+  bv->ops->setfromoptions   = BVSetFromOptions_Tensor;
 
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorBuildFirstColumn_C",BVTensorBuildFirstColumn_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorCompress_C",BVTensorCompress_Tensor));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorSetCompressTolerance_C",BVTensorSetCompressTolerance_Tensor));
+  PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetCompressTolerance_C",BVTensorGetCompressTolerance_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetDegree_C",BVTensorGetDegree_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorGetFactors_C",BVTensorGetFactors_Tensor));
   PetscCall(PetscObjectComposeFunction((PetscObject)bv,"BVTensorRestoreFactors_C",BVTensorRestoreFactors_Tensor));
@@ -811,5 +935,11 @@ PetscErrorCode BVCreateTensor(BV U,PetscInt d,BV *V)
   (*V)->orthog_block = U->orthog_block;
   (*V)->vmm          = U->vmm;
   (*V)->rrandom      = U->rrandom;
+
+  /* Options specific to the tensor BV, with the prefix of U */
+  PetscCall(BVSetOptionsPrefix(*V,((PetscObject)U)->prefix));
+  PetscObjectOptionsBegin((PetscObject)*V);
+  PetscCall(BVSetFromOptions_Tensor(*V,PetscOptionsObject));
+  PetscOptionsEnd();
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -510,6 +510,7 @@ PetscErrorCode BVSetMatrix(BV bv,Mat B,PetscBool indef)
     }
     if (B) PetscCall(PetscObjectReference((PetscObject)B));
     PetscCall(MatDestroy(&bv->matrix));
+    PetscCall(VecDestroy(&bv->Bdiag));
     bv->matrix = B;
     bv->indef  = indef;
     PetscCall(PetscObjectStateIncrease((PetscObject)bv));
@@ -591,7 +592,9 @@ PetscErrorCode BVApplyMatrix(BV bv,Vec x,Vec y)
 
    Note:
    This function computes Y = B*X, where B is the matrix given with
-   BVSetMatrix(). This operation is computed as in BVMatMult().
+   BVSetMatrix(). This operation is computed as in BVMatMult(), except
+   for a diagonal signature matrix, such as the one used in the hyperbolic
+   SVD, which is applied with pointwise products.
    If no matrix was specified, then it just copies Y = X.
 
    If no Y is given, the result is stored internally in the cached BV.
@@ -606,7 +609,10 @@ PetscErrorCode BVApplyMatrixBV(BV X,BV Y)
   PetscValidHeaderSpecific(X,BV_CLASSID,1);
   if (Y) {
     PetscValidHeaderSpecific(Y,BV_CLASSID,2);
-    if (X->matrix) PetscCall(BVMatMult(X,X->matrix,Y));
+    if (X->Bdiag) {
+      PetscCheck(X->k-X->l==Y->k-Y->l,PetscObjectComm((PetscObject)X),PETSC_ERR_ARG_SIZ,"Y has %" PetscInt_FMT " active columns, should match %" PetscInt_FMT " active columns in X",Y->k-Y->l,X->k-X->l);
+      PetscCall(BV_DiagonalMultBV(X,Y));
+    } else if (X->matrix) PetscCall(BVMatMult(X,X->matrix,Y));
     else PetscCall(BVCopy(X,Y));
   } else PetscCall(BV_IPMatMultBV(X));
   PetscFunctionReturn(PETSC_SUCCESS);
@@ -1629,6 +1635,8 @@ static inline PetscErrorCode BVDuplicate_Private(BV V,BV W)
   W->orthog_block = V->orthog_block;
   if (V->matrix) PetscCall(PetscObjectReference((PetscObject)V->matrix));
   W->matrix       = V->matrix;
+  if (V->Bdiag) PetscCall(PetscObjectReference((PetscObject)V->Bdiag));
+  W->Bdiag        = V->Bdiag;
   W->indef        = V->indef;
   W->vmm          = V->vmm;
   W->rrandom      = V->rrandom;
@@ -125,6 +125,7 @@ PetscErrorCode BVDestroy(BV *bv)
   PetscCall(PetscFree((*bv)->vtype));
   PetscCall(MatDestroy(&(*bv)->matrix));
   PetscCall(VecDestroy(&(*bv)->Bx));
+  PetscCall(VecDestroy(&(*bv)->Bdiag));
   PetscCall(VecDestroy(&(*bv)->buffer));
   PetscCall(BVDestroy(&(*bv)->cached));
   PetscCall(BVDestroy(&(*bv)->L));
@@ -186,6 +187,7 @@ PetscErrorCode BVCreate(MPI_Comm comm,BV *newbv)
   bv->buffer       = NULL;
   bv->Abuffer      = NULL;
   bv->Bx           = NULL;
+  bv->Bdiag        = NULL;
   bv->xid          = 0;
   bv->xstate       = 0;
   bv->cv[0]        = NULL;
@@ -441,13 +441,38 @@ PetscErrorCode BVDotColumnEnd(BV X,PetscInt j,PetscScalar *m)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*
+   BVNormDiagonal_Private - Computes z'*B*z when B is diagonal (e.g., a signature matrix),
+   in a single pass over z and without the intermediate vector B*z
+*/
+static inline PetscErrorCode BVNormDiagonal_Private(BV bv,Vec z,PetscScalar *p)
+{
+  PetscInt          i,n;
+  const PetscScalar *pz,*pd;
+  PetscScalar       lp=0.0;
+
+  PetscFunctionBegin;
+  PetscCall(VecGetLocalSize(z,&n));
+  PetscCall(VecGetArrayRead(z,&pz));
+  PetscCall(VecGetArrayRead(bv->Bdiag,&pd));
+  for (i=0;i<n;i++) lp += PetscConj(pz[i])*pd[i]*pz[i];
+  PetscCall(VecRestoreArrayRead(bv->Bdiag,&pd));
+  PetscCall(VecRestoreArrayRead(z,&pz));
+  PetscCallMPI(MPIU_Allreduce(&lp,p,1,MPIU_SCALAR,MPIU_SUM,PetscObjectComm((PetscObject)bv)));
+  PetscCall(PetscLogFlops(3.0*n));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 static inline PetscErrorCode BVNorm_Private(BV bv,Vec z,NormType type,PetscReal *val)
 {
   PetscScalar    p;
 
   PetscFunctionBegin;
-  PetscCall(BV_IPMatMult(bv,z));
-  PetscCall(VecDot(bv->Bx,z,&p));
+  if (bv->Bdiag && !bv->cuda && !bv->hip) PetscCall(BVNormDiagonal_Private(bv,z,&p));
+  else {
+    PetscCall(BV_IPMatMult(bv,z));
+    PetscCall(VecDot(bv->Bx,z,&p));
+  }
   PetscCall(BV_SafeSqrt(bv,p,val));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -125,6 +125,10 @@ int main(int argc,char **argv)
   /* Test BVTensorCompress */
   PetscCall(BVSetActiveColumns(V,0,l));
   PetscCall(BVTensorCompress(V,0));
+  PetscCall(BVTensorGetFactors(V,&UU,NULL));
+  PetscCall(BVGetActiveColumns(UU,NULL,&j));
+  PetscCall(BVTensorRestoreFactors(V,&UU,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Columns of U after compression: %" PetscInt_FMT "\n",j));
   if (verbose) {
     PetscCall(PetscPrintf(PETSC_COMM_WORLD,"After BVTensorCompress - - - - -\n"));
     PetscCall(BVView(V,view));
@@ -178,4 +182,10 @@ int main(int argc,char **argv)
          args: -bv_type {{vecs svec mat}} -vec_type hip
          requires: hip
 
+   test:
+      suffix: 2
+      nsize: 2
+      args: -bv_type {{vecs svec mat}} -bv_tensor_compress_tol 0.65
+      filter: grep -v "doing matmult"
+
 TEST*/
@@ -10,6 +10,13 @@
 
 #include <slepc/private/dsimpl.h>
 #include <slepcblaslapack.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
+
+/* problems of size up to this value are solved with Jacobi in DSSolveBatch() */
+#define DS_BATCH_JACOBI_MAXN     16
+#define DS_BATCH_JACOBI_MAXSWEEP 50
 
 static PetscErrorCode DSAllocate_HEP(DS ds,PetscInt ld)
 {
@@ -841,6 +848,173 @@ static PetscErrorCode DSReallocate_HEP(DS ds,PetscInt ld)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+#if !defined(PETSC_USE_COMPLEX)
+/*
+   Cyclic Jacobi method for a tiny real symmetric matrix A of order n (leading
+   dimension n), which is destroyed. On exit, w contains the eigenvalues in
+   ascending order and, if V is not NULL, its columns are the eigenvectors.
+   It does not call PETSc functions, since it runs inside the threaded loop
+   of DSSolveBatch_HEP(), and returns PETSC_FALSE if it does not converge.
+*/
+static PetscBool DSBatchJacobi_HEP(PetscInt n,PetscReal *A,PetscReal *w,PetscReal *V)
+{
+  PetscInt  i,j,k,p,q,sweep;
+  PetscReal off,nrm,app,aqq,apq,theta,t,c,s,akp,akq;
+
+  if (V) for (j=0;j<n;j++) for (i=0;i<n;i++) V[i+j*n] = (i==j)? 1.0: 0.0;
+  for (sweep=0;sweep<DS_BATCH_JACOBI_MAXSWEEP;sweep++) {
+    off = nrm = 0.0;
+    for (j=0;j<n;j++) {
+      for (i=0;i<n;i++) {
+        nrm += A[i+j*n]*A[i+j*n];
+        if (i!=j) off += A[i+j*n]*A[i+j*n];
+      }
+    }
+    if (off<=PETSC_MACHINE_EPSILON*PETSC_MACHINE_EPSILON*nrm) break;
+    for (p=0;p<n-1;p++) {
+      for (q=p+1;q<n;q++) {
+        apq = A[p+q*n];
+        if (apq==0.0) continue;
+        app   = A[p+p*n];
+        aqq   = A[q+q*n];
+        theta = (aqq-app)/(2.0*apq);
+        t     = ((theta>=0.0)? 1.0: -1.0)/(PetscAbsReal(theta)+PetscSqrtReal(theta*theta+1.0));
+        c     = 1.0/PetscSqrtReal(t*t+1.0);
+        s     = t*c;
+        for (k=0;k<n;k++) {  /* A = A*J */
+          akp = A[k+p*n]; akq = A[k+q*n];
+          A[k+p*n] = c*akp-s*akq;
+          A[k+q*n] = s*akp+c*akq;
+        }
+        for (k=0;k<n;k++) {  /* A = J'*A */
+          akp = A[p+k*n]; akq = A[q+k*n];
+          A[p+k*n] = c*akp-s*akq;
+          A[q+k*n] = s*akp+c*akq;
+        }
+        if (V) {
+          for (k=0;k<n;k++) {  /* V = V*J */
+            akp = V[k+p*n]; akq = V[k+q*n];
+            V[k+p*n] = c*akp-s*akq;
+            V[k+q*n] = s*akp+c*akq;
+          }
+        }
+      }
+    }
+  }
+  /* sort eigenvalues in ascending order, together with the eigenvectors */
+  for (i=0;i<n;i++) w[i] = A[i+i*n];
+  for (i=0;i<n-1;i++) {
+    p = i;
+    for (j=i+1;j<n;j++) if (w[j]<w[p]) p = j;
+    if (p==i) continue;
+    t = w[i]; w[i] = w[p]; w[p] = t;
+    if (V) for (k=0;k<n;k++) { t = V[k+i*n]; V[k+i*n] = V[k+p*n]; V[k+p*n] = t; }
+  }
+  return (sweep<DS_BATCH_JACOBI_MAXSWEEP)? PETSC_TRUE: PETSC_FALSE;
+}
+#endif
+
+static PetscErrorCode DSSolveBatch_HEP(DS ds,PetscInt nb,PetscInt n,PetscInt m,PetscScalar *A,PetscScalar *w,PetscScalar *X,PetscScalar *Y)
+{
+  PetscInt     b,nt=1,nn=n*n;
+  PetscBLASInt n_,lwork,liwork,qiwork,info,fail=0,*iwork;
+  PetscScalar  *work,qwork;
+  PetscReal    *ev;
+  const char   *jobz = X? "V": "N";
+#if defined(PETSC_USE_COMPLEX)
+  PetscBLASInt lrwork;
+  PetscReal    *rwork,qrwork;
+#else
+  PetscReal    *T;
+#endif
+
+  PetscFunctionBegin;
+  PetscCheck(m==n,PETSC_COMM_SELF,PETSC_ERR_ARG_SIZ,"DSHEP requires square matrices, but the problems are %" PetscInt_FMT "x%" PetscInt_FMT,n,m);
+  PetscCheck(!Y,PETSC_COMM_SELF,PETSC_ERR_ARG_WRONG,"DSHEP does not compute right vectors, Y must be NULL");
+  PetscCall(PetscBLASIntCast(n,&n_));
+#if defined(_OPENMP)
+  nt = omp_get_max_threads();
+#endif
+
+#if !defined(PETSC_USE_COMPLEX)
+  if (n<=DS_BATCH_JACOBI_MAXN) {
+    PetscCall(PetscMalloc1(X? nt*nn: 0,&T));
+#if defined(_OPENMP)
+    #pragma omp parallel for schedule(static) reduction(max:fail)
+#endif
+    for (b=0;b<nb;b++) {
+      PetscInt  i,tid=0;
+      PetscReal *Ab=A+b*nn;
+
+#if defined(_OPENMP)
+      tid = omp_get_thread_num();
+#endif
+      if (X) {  /* keep A and accumulate the rotations in X */
+        for (i=0;i<nn;i++) T[tid*nn+i] = Ab[i];
+        Ab = T+tid*nn;
+      }
+      if (!DSBatchJacobi_HEP(n,Ab,w+b*n,X? X+b*nn: NULL)) fail = 1;
+    }
+    PetscCall(PetscFree(T));
+    PetscCheck(!fail,PETSC_COMM_SELF,PETSC_ERR_CONV_FAILED,"Jacobi method did not converge for some problem of the batch");
+    PetscFunctionReturn(PETSC_SUCCESS);
+  }
+#endif
+
+  /* workspace query, then allocate workspace for each thread */
+  lwork = -1; liwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  lrwork = -1;
+  PetscCallBLAS("LAPACKsyevd",LAPACKsyevd_(jobz,"L",&n_,A,&n_,NULL,&qwork,&lwork,&qrwork,&lrwork,&qiwork,&liwork,&info));
+  SlepcCheckLapackInfo("syevd",info);
+  PetscCall(PetscBLASIntCast((PetscInt)qrwork,&lrwork));
+#else
+  PetscCallBLAS("LAPACKsyevd",LAPACKsyevd_(jobz,"L",&n_,A,&n_,NULL,&qwork,&lwork,&qiwork,&liwork,&info));
+  SlepcCheckLapackInfo("syevd",info);
+#endif
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(qwork),&lwork));
+  liwork = qiwork;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscMalloc4(nt*lwork,&work,nt*lrwork,&rwork,nt*liwork,&iwork,nt*n,&ev));
+#else
+  PetscCall(PetscMalloc3(nt*lwork,&work,nt*liwork,&iwork,nt*n,&ev));
+#endif
+
+#if defined(_OPENMP)
+  #pragma omp parallel for schedule(static) reduction(max:fail)
+#endif
+  for (b=0;b<nb;b++) {
+    PetscInt     i,tid=0;
+    PetscBLASInt lw=lwork,liw=liwork,binfo;
+    PetscScalar  *Z=A+b*nn;
+#if defined(PETSC_USE_COMPLEX)
+    PetscBLASInt lrw=lrwork;
+#endif
+
+#if defined(_OPENMP)
+    tid = omp_get_thread_num();
+#endif
+    if (X) {  /* syevd overwrites the matrix with the eigenvectors */
+      Z = X+b*nn;
+      for (i=0;i<nn;i++) Z[i] = A[b*nn+i];
+    }
+#if defined(PETSC_USE_COMPLEX)
+    LAPACKsyevd_(jobz,"L",&n_,Z,&n_,ev+tid*n,work+tid*lwork,&lw,rwork+tid*lrwork,&lrw,iwork+tid*liwork,&liw,&binfo);
+#else
+    LAPACKsyevd_(jobz,"L",&n_,Z,&n_,ev+tid*n,work+tid*lwork,&lw,iwork+tid*liwork,&liw,&binfo);
+#endif
+    if (binfo) fail = 1;
+    for (i=0;i<n;i++) w[b*n+i] = ev[tid*n+i];
+  }
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree4(work,rwork,iwork,ev));
+#else
+  PetscCall(PetscFree3(work,iwork,ev));
+#endif
+  PetscCheck(!fail,PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in LAPACK subroutine syevd for some problem of the batch");
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*MC
    DSHEP - Dense Hermitian Eigenvalue Problem.
 
@@ -867,7 +1041,7 @@ static PetscErrorCode DSReallocate_HEP(DS ds,PetscInt ld)
 .  2 - Divide and Conquer (_stedc)
 -  3 - Block Divide and Conquer (real scalars only)
 
-.seealso: DSCreate(), DSSetType(), DSType
+.seealso: DSCreate(), DSSetType(), DSType, DSSolveBatch()
 M*/
 SLEPC_EXTERN PetscErrorCode DSCreate_HEP(DS ds)
 {
@@ -892,5 +1066,6 @@ SLEPC_EXTERN PetscErrorCode DSCreate_HEP(DS ds)
 #endif
   ds->ops->setcompact    = DSSetCompact_HEP;
   ds->ops->reallocate    = DSReallocate_HEP;
+  ds->ops->solvebatch    = DSSolveBatch_HEP;
   PetscFunctionReturn(PETSC_SUCCESS);
 }
@@ -10,6 +10,9 @@
 
 #include <slepc/private/dsimpl.h>       /*I "slepcds.h" I*/
 #include <slepcblaslapack.h>
+#if defined(_OPENMP)
+#include <omp.h>
+#endif
 
 typedef struct {
   PetscInt m;              /* number of columns */
@@ -744,6 +747,74 @@ static PetscErrorCode DSReallocate_SVD(DS ds,PetscInt ld)
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+static PetscErrorCode DSSolveBatch_SVD(DS ds,PetscInt nb,PetscInt n,PetscInt m,PetscScalar *A,PetscScalar *w,PetscScalar *X,PetscScalar *Y)
+{
+  PetscInt     b,nt=1,k=PetscMin(n,m);
+  PetscBLASInt n_,m_,k_,lwork,info,fail=0,*iwork;
+  PetscScalar  *work,*U,*VT,qwork;
+  PetscReal    *sv;
+  const char   *jobz = (X || Y)? "S": "N";
+#if defined(PETSC_USE_COMPLEX)
+  PetscInt     lrwork = (X || Y)? PetscMax(5*k*k+5*k,2*PetscMax(n,m)*k+2*k*k+k): 7*k;
+  PetscReal    *rwork;
+#endif
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(n,&n_));
+  PetscCall(PetscBLASIntCast(m,&m_));
+  PetscCall(PetscBLASIntCast(k,&k_));
+#if defined(_OPENMP)
+  nt = omp_get_max_threads();
+#endif
+
+  /* workspace query, then allocate workspace for each thread */
+  lwork = -1;
+#if defined(PETSC_USE_COMPLEX)
+  PetscCallBLAS("LAPACKgesdd",LAPACKgesdd_(jobz,&n_,&m_,A,&n_,NULL,NULL,&n_,NULL,&k_,&qwork,&lwork,NULL,NULL,&info));
+#else
+  PetscCallBLAS("LAPACKgesdd",LAPACKgesdd_(jobz,&n_,&m_,A,&n_,NULL,NULL,&n_,NULL,&k_,&qwork,&lwork,NULL,&info));
+#endif
+  SlepcCheckLapackInfo("gesdd",info);
+  PetscCall(PetscBLASIntCast((PetscInt)PetscRealPart(qwork),&lwork));
+  PetscCall(PetscMalloc5(nt*lwork,&work,nt*8*k,&iwork,nt*k,&sv,X? 0: nt*n*k,&U,nt*k*m,&VT));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscMalloc1(nt*lrwork,&rwork));
+#endif
+
+#if defined(_OPENMP)
+  #pragma omp parallel for schedule(static) reduction(max:fail)
+#endif
+  for (b=0;b<nb;b++) {
+    PetscInt     i,j,tid=0;
+    PetscBLASInt lw=lwork,binfo;
+    PetscScalar  *Ub,*VTb;
+
+#if defined(_OPENMP)
+    tid = omp_get_thread_num();
+#endif
+    Ub  = X? X+b*n*k: U+tid*n*k;
+    VTb = VT+tid*k*m;
+#if defined(PETSC_USE_COMPLEX)
+    LAPACKgesdd_(jobz,&n_,&m_,A+b*n*m,&n_,sv+tid*k,Ub,&n_,VTb,&k_,work+tid*lwork,&lw,rwork+tid*lrwork,iwork+tid*8*k,&binfo);
+#else
+    LAPACKgesdd_(jobz,&n_,&m_,A+b*n*m,&n_,sv+tid*k,Ub,&n_,VTb,&k_,work+tid*lwork,&lw,iwork+tid*8*k,&binfo);
+#endif
+    if (binfo) fail = 1;
+    for (i=0;i<k;i++) w[b*k+i] = sv[tid*k+i];
+    if (Y) {  /* transpose VT returned by Lapack */
+      for (j=0;j<k;j++) {
+        for (i=0;i<m;i++) Y[b*m*k+i+j*m] = PetscConj(VTb[j+i*k]);
+      }
+    }
+  }
+  PetscCall(PetscFree5(work,iwork,sv,U,VT));
+#if defined(PETSC_USE_COMPLEX)
+  PetscCall(PetscFree(rwork));
+#endif
+  PetscCheck(!fail,PETSC_COMM_SELF,PETSC_ERR_LIB,"Error in LAPACK subroutine gesdd for some problem of the batch");
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*MC
    DSSVD - Dense Singular Value Decomposition.
 
@@ -775,7 +846,7 @@ static PetscErrorCode DSReallocate_SVD(DS ds,PetscInt ld)
 +  0 - Implicit zero-shift QR for bidiagonals (_bdsqr)
 -  1 - Divide and Conquer (_bdsdc or _gesdd)
 
-.seealso: DSCreate(), DSSetType(), DSType, DSSVDSetDimensions()
+.seealso: DSCreate(), DSSetType(), DSType, DSSVDSetDimensions(), DSSolveBatch()
 M*/
 SLEPC_EXTERN PetscErrorCode DSCreate_SVD(DS ds)
 {
@@ -800,6 +871,7 @@ SLEPC_EXTERN PetscErrorCode DSCreate_SVD(DS ds)
 #endif
   ds->ops->setcompact    = DSSetCompact_SVD;
   ds->ops->reallocate    = DSReallocate_SVD;
+  ds->ops->solvebatch    = DSSolveBatch_SVD;
   PetscCall(PetscObjectComposeFunction((PetscObject)ds,"DSSVDSetDimensions_C",DSSVDSetDimensions_SVD));
   PetscCall(PetscObjectComposeFunction((PetscObject)ds,"DSSVDGetDimensions_C",DSSVDGetDimensions_SVD));
   PetscFunctionReturn(PETSC_SUCCESS);
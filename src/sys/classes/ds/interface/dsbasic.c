@@ -398,7 +398,11 @@ PetscErrorCode DSGetMethod(DS ds,PetscInt *meth)
 
    The 'distributed' parallel mode can be used in some DS types only, such
    as the contour integral method of DSNEP. In this case, every MPI process
-   will be in charge of part of the computation.
+   will be in charge of part of the computation. This mode is also recognized
+   by EPSLAPACK (standard Hermitian problems) and SVDLAPACK (standard SVD),
+   that instead of gathering the matrix in all processes reduce it in parallel
+   to tridiagonal or bidiagonal form, and compute only the wanted eigenvectors
+   or singular vectors of the condensed matrix, with MRRR.
 
    Level: advanced
 
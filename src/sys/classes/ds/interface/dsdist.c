@@ -0,0 +1,428 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+/*
+   Reduction of a distributed dense matrix to condensed form, used when the DS
+   operates in distributed parallel mode. The matrix is stored by blocks of rows
+   (MATMPIDENSE) and is reduced with Householder reflectors whose application
+   requires one global reduction per step. The resulting tridiagonal or bidiagonal
+   matrix is replicated in all processes, where only the wanted eigenvectors or
+   singular vectors are computed, and the reflectors are later applied to the rows
+   of these vectors owned by each process
+*/
+
+#include <slepc/private/dsimpl.h>      /*I "slepcds.h" I*/
+#include <slepcblaslapack.h>
+
+/*
+   Householder reflector H = I - tau*v*v' such that H'*[alpha;x] = [beta;0], computed
+   as in LAPACK's _larfg from alpha and the 2-norm of x, without rescaling. On output,
+   alpha is overwritten with beta, and x must be multiplied by scale to get v(2:end)
+*/
+static inline void DSLarfg_Private(PetscScalar *alpha,PetscReal xnorm,PetscScalar *tau,PetscScalar *scale)
+{
+  PetscReal alphr = PetscRealPart(*alpha),alphi = PetscImaginaryPart(*alpha),beta;
+
+  if (xnorm==0.0 && alphi==0.0) {
+    *tau   = 0.0;
+    *scale = 1.0;
+    return;
+  }
+  beta = PetscSqrtReal(alphr*alphr+alphi*alphi+xnorm*xnorm);
+  if (alphr>=0.0) beta = -beta;
+  *tau   = (beta-*alpha)/beta;
+  *scale = 1.0/(*alpha-beta);
+  *alpha = beta;
+}
+
+/*
+   DSReduceDistributed_HEP - Reduces a Hermitian matrix stored as MATMPIDENSE to
+   real symmetric tridiagonal form T = Q'*A*Q, with Q = H(0)*H(1)*...*H(n-2), in
+   the same way as LAPACK's _hetd2 with uplo='L'.
+
+   On output, d and e (replicated) contain the diagonal and off-diagonal of T, tau
+   (replicated, length n-1) the scalar factors of the reflectors, and A(k+1:n,k)
+   the vector of H(k), with unit first entry.
+*/
+PetscErrorCode DSReduceDistributed_HEP(Mat A,PetscReal *d,PetscReal *e,PetscScalar *tau)
+{
+  PetscInt     i,k,n,m,i0,rstart,rend,lda;
+  PetscBLASInt m_,nr_,lda_,one=1,two=2;
+  PetscMPIInt  len;
+  PetscScalar  *pA,*v,*w,*buf,*P,*Q,alpha,scale,sone=1.0,smone=-1.0,szero=0.0;
+  PetscReal    rbuf[3],rsum[3],*dloc;
+  MPI_Comm     comm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)A,&comm));
+  PetscCall(MatGetSize(A,&n,NULL));
+  PetscCall(MatGetOwnershipRange(A,&rstart,&rend));
+  PetscCall(MatDenseGetLDA(A,&lda));
+  PetscCall(PetscBLASIntCast(lda,&lda_));
+  PetscCall(PetscMalloc6(n,&v,n,&w,n+1,&buf,2*n,&P,2*n,&Q,n,&dloc));
+  PetscCall(MatDenseGetArray(A,&pA));
+  for (k=0;k<n-1;k++) {
+    m  = n-k-1;
+    i0 = PetscMax(rstart,k+1);   /* first local row of the trailing submatrix */
+    PetscCall(PetscBLASIntCast(m,&m_));
+    PetscCall(PetscBLASIntCast(PetscMax(rend-i0,0),&nr_));
+
+    /* reflector H(k) that annihilates A(k+2:n,k) */
+    rbuf[0] = rbuf[1] = rbuf[2] = 0.0;
+    for (i=PetscMax(rstart,k+2);i<rend;i++) rbuf[0] += PetscRealPart(PetscConj(pA[i-rstart+k*lda])*pA[i-rstart+k*lda]);
+    if (k+1>=rstart && k+1<rend) {
+      rbuf[1] = PetscRealPart(pA[k+1-rstart+k*lda]);
+      rbuf[2] = PetscImaginaryPart(pA[k+1-rstart+k*lda]);
+    }
+    PetscCallMPI(MPIU_Allreduce(rbuf,rsum,3,MPIU_REAL,MPIU_SUM,comm));
+#if defined(PETSC_USE_COMPLEX)
+    alpha = PetscCMPLX(rsum[1],rsum[2]);
+#else
+    alpha = rsum[1];
+#endif
+    DSLarfg_Private(&alpha,PetscSqrtReal(rsum[0]),tau+k,&scale);
+    e[k] = PetscRealPart(alpha);
+    for (i=PetscMax(rstart,k+2);i<rend;i++) pA[i-rstart+k*lda] *= scale;
+    if (k+1>=rstart && k+1<rend) pA[k+1-rstart+k*lda] = 1.0;
+    if (tau[k]==0.0) continue;
+
+    /* gather v in all processes */
+    PetscCall(PetscArrayzero(buf,m));
+    for (i=i0;i<rend;i++) buf[i-k-1] = pA[i-rstart+k*lda];
+    PetscCall(PetscMPIIntCast(m,&len));
+    PetscCallMPI(MPIU_Allreduce(buf,v,len,MPIU_SCALAR,MPIU_SUM,comm));
+
+    /* x = tau*A22*v and x'*v, with A22 = A(k+1:n,k+1:n) */
+    PetscCall(PetscArrayzero(buf,m+1));
+    if (nr_) {
+      PetscCallBLAS("BLASgemv",BLASgemv_("N",&nr_,&m_,tau+k,pA+(i0-rstart)+(k+1)*lda,&lda_,v,&one,&szero,buf+(i0-k-1),&one));
+      for (i=i0;i<rend;i++) buf[m] += PetscConj(buf[i-k-1])*v[i-k-1];
+    }
+    PetscCall(PetscMPIIntCast(m+1,&len));
+    PetscCallMPI(MPIU_Allreduce(buf,w,len,MPIU_SCALAR,MPIU_SUM,comm));
+
+    /* w = x - 1/2*tau*(x'*v)*v, and rank-2 update A22 = A22 - v*w' - w*v' of the local rows */
+    alpha = -0.5*tau[k]*w[m];
+    for (i=0;i<m;i++) w[i] += alpha*v[i];
+    if (nr_) {
+      for (i=i0;i<rend;i++) {
+        P[i-i0]           = v[i-k-1];
+        P[i-i0+(rend-i0)] = w[i-k-1];
+      }
+      PetscCall(PetscArraycpy(Q,w,m));
+      PetscCall(PetscArraycpy(Q+m,v,m));
+      PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&nr_,&m_,&two,&smone,P,&nr_,Q,&m_,&sone,pA+(i0-rstart)+(k+1)*lda,&lda_));
+    }
+    PetscCall(PetscLogFlops(2.0*(rend-i0)*m+4.0*(rend-i0)*m+4.0*m));
+  }
+
+  /* the diagonal is not modified after the corresponding step */
+  PetscCall(PetscArrayzero(dloc,n));
+  for (i=rstart;i<rend;i++) dloc[i] = PetscRealPart(pA[i-rstart+i*lda]);
+  PetscCall(PetscMPIIntCast(n,&len));
+  PetscCallMPI(MPIU_Allreduce(dloc,d,len,MPIU_REAL,MPIU_SUM,comm));
+  PetscCall(MatDenseRestoreArray(A,&pA));
+  PetscCall(PetscFree6(v,w,buf,P,Q,dloc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Computes the eigenvalues il:iu (0-based, in ascending order) of the symmetric tridiagonal
+   matrix with diagonal d and off-diagonal e with _stevr, and the eigenvectors if jobz="V"
+*/
+static PetscErrorCode DSStevr_Private(const char *jobz,PetscInt n,const PetscReal *d,const PetscReal *e,PetscInt il,PetscInt iu,PetscReal *w,PetscReal *Z,PetscInt ldz)
+{
+  PetscBLASInt n_,il_,iu_,m,ldz_,lwork,liwork,*iwork,info;
+  PetscReal    *dd,*ee,*work,vl=0.0,vu=0.0,abstol=0.0;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(n,&n_));
+  PetscCall(PetscBLASIntCast(il+1,&il_));
+  PetscCall(PetscBLASIntCast(iu+1,&iu_));
+  PetscCall(PetscBLASIntCast(PetscMax(ldz,1),&ldz_));
+  lwork  = 20*n_;
+  liwork = 10*n_;
+  PetscCall(PetscMalloc4(n,&dd,n,&ee,lwork,&work,liwork+2*n,&iwork));
+  PetscCall(PetscArraycpy(dd,d,n));
+  PetscCall(PetscArraycpy(ee,e,n-1));
+  PetscCallBLAS("LAPACKstevr",LAPACKstevr_(jobz,(il==0 && iu==n-1)?"A":"I",&n_,dd,ee,&vl,&vu,&il_,&iu_,&abstol,&m,w,Z,&ldz_,iwork+liwork,work,&lwork,iwork,&liwork,&info));
+  SlepcCheckLapackInfo("stevr",info);
+  PetscCheck(m==iu-il+1,PETSC_COMM_SELF,PETSC_ERR_LIB,"Only %d of %" PetscInt_FMT " eigenvalues were computed in stevr",(int)m,iu-il+1);
+  PetscCall(PetscFree4(dd,ee,work,iwork));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   DSSolveDistributed_HEP - Computes the nev eigenvalues of the tridiagonal matrix obtained
+   in DSReduceDistributed_HEP() that come first in the sorting criterion sc, and the rows
+   rstart:rend of the corresponding eigenvectors.
+
+   All eigenvalues are computed and sorted, but the eigenvectors are obtained only for the
+   wanted ones, with one call to _stevr for each run of consecutive eigenvalues, so the
+   workspace is of size n*nev. On output, eig contains the eigenvalues in the order of sc
+   and X the local rows of the eigenvectors of T, to be passed to DSBackTransformDistributed_HEP().
+*/
+PetscErrorCode DSSolveDistributed_HEP(SlepcSC sc,PetscInt n,const PetscReal *d,const PetscReal *e,PetscInt nev,PetscScalar *eig,PetscInt rstart,PetscInt rend,PetscScalar *X,PetscInt ldx)
+{
+  PetscInt    i,j,k,r,*perm,*pos;
+  PetscReal   *w,*Z;
+  PetscScalar *eigr,*eigi;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc6(n,&w,n*nev,&Z,n,&eigr,n,&eigi,n,&perm,nev,&pos));
+  PetscCall(DSStevr_Private("N",n,d,e,0,n-1,w,NULL,1));
+  for (i=0;i<n;i++) {
+    eigr[i] = w[i];
+    eigi[i] = 0.0;
+    perm[i] = i;
+  }
+  PetscCall(SlepcSortEigenvalues(sc,n,eigr,eigi,perm));
+  for (k=0;k<nev;k++) {
+    eig[k] = eigr[perm[k]];
+    pos[k] = k;
+  }
+  PetscCall(PetscSortIntWithArray(nev,perm,pos));
+  for (j=0;j<nev;j+=r) {
+    for (r=1;j+r<nev && perm[j+r]==perm[j]+r;r++);
+    PetscCall(DSStevr_Private("V",n,d,e,perm[j],perm[j+r-1],w,Z,n));
+    for (k=0;k<r;k++) {
+      for (i=rstart;i<rend;i++) X[i-rstart+pos[j+k]*ldx] = Z[i+k*n];
+    }
+  }
+  PetscCall(PetscFree6(w,Z,eigr,eigi,perm,pos));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   DSSolveDistributed_SVD - Computes the nsv largest or smallest singular values of the
+   nxn upper bidiagonal matrix B obtained in DSReduceDistributed_SVD(), with diagonal d and
+   superdiagonal e, and the local rows of the corresponding singular vectors.
+
+   The singular triplets are obtained from the eigenpairs of the Golub-Kahan tridiagonal
+   matrix of order 2n, with zero diagonal and off-diagonal (d(0),e(0),d(1),...,d(n-1)), as
+   in LAPACK's _bdsvdx. Each eigenvector (v(0),u(0),v(1),u(1),...) associated with a positive
+   eigenvalue sigma contains the singular vectors u and v, scaled by 1/sqrt(2), that are
+   normalized separately. X gets the rows ustart:uend of u (zero beyond n) and Y the rows
+   vstart:vend of v, with the singular values in decreasing order if largest=true.
+*/
+PetscErrorCode DSSolveDistributed_SVD(PetscInt n,const PetscReal *d,const PetscReal *e,PetscBool largest,PetscInt nsv,PetscReal *sigma,PetscInt ustart,PetscInt uend,PetscScalar *X,PetscInt ldx,PetscInt vstart,PetscInt vend,PetscScalar *Y,PetscInt ldy)
+{
+  PetscInt  i,c,k;
+  PetscReal *t,*z,*w,*Z,*q,nrmu,nrmv;
+
+  PetscFunctionBegin;
+  PetscCall(PetscMalloc3(2*n,&t,2*n,&w,2*n*nsv,&Z));
+  PetscCall(PetscCalloc1(2*n,&z));
+  for (i=0;i<n;i++) {
+    t[2*i] = d[i];
+    if (i<n-1) t[2*i+1] = e[i];
+  }
+  PetscCall(DSStevr_Private("V",2*n,z,t,largest?2*n-nsv:n,(largest?2*n:n+nsv)-1,w,Z,2*n));
+  for (c=0;c<nsv;c++) {
+    k = largest? nsv-c-1: c;
+    q = Z+2*n*c;
+    sigma[k] = PetscAbsReal(w[c]);
+    nrmu = nrmv = 0.0;
+    for (i=0;i<n;i++) {
+      nrmv += q[2*i]*q[2*i];
+      nrmu += q[2*i+1]*q[2*i+1];
+    }
+    nrmu = (nrmu>0.0)? 1.0/PetscSqrtReal(nrmu): 1.0;
+    nrmv = (nrmv>0.0)? 1.0/PetscSqrtReal(nrmv): 1.0;
+    for (i=ustart;i<uend;i++) X[i-ustart+k*ldx] = (i<n)? q[2*i+1]*nrmu: 0.0;
+    for (i=vstart;i<vend;i++) Y[i-vstart+k*ldy] = q[2*i]*nrmv;
+  }
+  PetscCall(PetscFree3(t,w,Z));
+  PetscCall(PetscFree(z));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Applies X = H(k)*X for k=kend-1,...,0, where the vector of the reflector H(k) is stored
+   in column k of V from global row k+off, with the corresponding local rows of X
+*/
+static PetscErrorCode DSApplyReflectors_Private(MPI_Comm comm,PetscInt kend,PetscInt off,const PetscScalar *V,PetscInt ldv,PetscInt vstart,PetscInt vend,const PetscScalar *tau,PetscInt nc,PetscScalar *X,PetscInt ldx)
+{
+  PetscInt     j,k,i0;
+  PetscBLASInt nc_,nr_,ldv_,ldx_,one=1;
+  PetscMPIInt  len;
+  PetscScalar  *y,*yc,sone=1.0,szero=0.0,alpha;
+
+  PetscFunctionBegin;
+  PetscCall(PetscBLASIntCast(nc,&nc_));
+  PetscCall(PetscBLASIntCast(PetscMax(ldv,1),&ldv_));
+  PetscCall(PetscBLASIntCast(PetscMax(ldx,1),&ldx_));
+  PetscCall(PetscMPIIntCast(nc,&len));
+  PetscCall(PetscMalloc2(nc,&y,nc,&yc));
+  for (k=kend-1;k>=0;k--) {
+    if (tau[k]==0.0) continue;
+    i0 = PetscMax(vstart,k+off);
+    PetscCall(PetscBLASIntCast(PetscMax(vend-i0,0),&nr_));
+    /* y = v'*X */
+    if (nr_) PetscCallBLAS("BLASgemv",BLASgemv_("C",&nr_,&nc_,&sone,X+(i0-vstart),&ldx_,(PetscScalar*)V+(i0-vstart)+k*ldv,&one,&szero,yc,&one));
+    else PetscCall(PetscArrayzero(yc,nc));
+    PetscCallMPI(MPIU_Allreduce(yc,y,len,MPIU_SCALAR,MPIU_SUM,comm));
+    if (!nr_) continue;
+    for (j=0;j<nc;j++) y[j] = PetscConj(y[j]);
+    /* X = X - tau*v*y */
+    alpha = -tau[k];
+    PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&nr_,&nc_,&one,&alpha,(PetscScalar*)V+(i0-vstart)+k*ldv,&ldv_,y,&one,&sone,X+(i0-vstart),&ldx_));
+    PetscCall(PetscLogFlops(4.0*(vend-i0)*nc));
+  }
+  PetscCall(PetscFree2(y,yc));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   DSBackTransformDistributed_HEP - Computes X = Q*X, where Q is the transformation
+   computed by DSReduceDistributed_HEP() on matrix A, and X (with nc columns) contains
+   the rows of the eigenvectors of T corresponding to the local rows of A.
+*/
+PetscErrorCode DSBackTransformDistributed_HEP(Mat A,const PetscScalar *tau,PetscInt nc,PetscScalar *X,PetscInt ldx)
+{
+  PetscInt          n,rstart,rend,lda;
+  const PetscScalar *pA;
+
+  PetscFunctionBegin;
+  PetscCall(MatGetSize(A,&n,NULL));
+  PetscCall(MatGetOwnershipRange(A,&rstart,&rend));
+  PetscCall(MatDenseGetLDA(A,&lda));
+  PetscCall(MatDenseGetArrayRead(A,&pA));
+  PetscCall(DSApplyReflectors_Private(PetscObjectComm((PetscObject)A),n-1,1,pA,lda,rstart,rend,tau,nc,X,ldx));
+  PetscCall(MatDenseRestoreArrayRead(A,&pA));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   DSReduceDistributed_SVD - Reduces an MxN matrix (M>=N) stored as MATMPIDENSE to
+   real upper bidiagonal form B = Q'*A*P, with Q = H(0)*...*H(N-1) and P = G(0)*...*G(N-2),
+   in the same way as LAPACK's _gebd2.
+
+   On output, d and e (replicated) contain the diagonal and superdiagonal of B, tauq
+   and taup (replicated, length N) the scalar factors of the reflectors, A(k:M,k) the
+   vector of H(k), with unit first entry, and column k of G the vector of G(k), from
+   row k+1. G is distributed as the columns of A, that is, it contains the rows
+   cstart:cend of the vectors, where cstart:cend is the local column range of A, with
+   leading dimension cend-cstart.
+*/
+PetscErrorCode DSReduceDistributed_SVD(Mat A,PetscReal *d,PetscReal *e,PetscScalar *tauq,PetscScalar *taup,PetscScalar *G)
+{
+  PetscInt     i,k,M,N,m,i0,rstart,rend,cstart,cend,lda;
+  PetscBLASInt m_,nr_,lda_,one=1;
+  PetscMPIInt  len;
+  PetscScalar  *pA,*buf,*y,*u,*z,alpha,scale,sone=1.0,szero=0.0;
+  PetscReal    rbuf[3],rsum[3],xnorm;
+  MPI_Comm     comm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)A,&comm));
+  PetscCall(MatGetSize(A,&M,&N));
+  PetscCheck(M>=N,comm,PETSC_ERR_SUP,"Only implemented for M>=N");
+  PetscCall(MatGetOwnershipRange(A,&rstart,&rend));
+  PetscCall(MatGetOwnershipRangeColumn(A,&cstart,&cend));
+  PetscCall(MatDenseGetLDA(A,&lda));
+  PetscCall(PetscBLASIntCast(lda,&lda_));
+  PetscCall(PetscMalloc4(2*N,&buf,2*N,&y,N,&u,PetscMax(rend-rstart,1),&z));
+  PetscCall(PetscArrayzero(G,(cend-cstart)*N));
+  PetscCall(MatDenseGetArray(A,&pA));
+  for (k=0;k<N;k++) {
+    m  = N-k-1;
+    i0 = PetscMax(rstart,k);   /* first local row of the active submatrix */
+    PetscCall(PetscBLASIntCast(m,&m_));
+    PetscCall(PetscBLASIntCast(PetscMax(rend-i0,0),&nr_));
+
+    /* reflector H(k) that annihilates A(k+1:M,k) */
+    rbuf[0] = rbuf[1] = rbuf[2] = 0.0;
+    for (i=PetscMax(rstart,k+1);i<rend;i++) rbuf[0] += PetscRealPart(PetscConj(pA[i-rstart+k*lda])*pA[i-rstart+k*lda]);
+    if (k>=rstart && k<rend) {
+      rbuf[1] = PetscRealPart(pA[k-rstart+k*lda]);
+      rbuf[2] = PetscImaginaryPart(pA[k-rstart+k*lda]);
+    }
+    PetscCallMPI(MPIU_Allreduce(rbuf,rsum,3,MPIU_REAL,MPIU_SUM,comm));
+#if defined(PETSC_USE_COMPLEX)
+    alpha = PetscCMPLX(rsum[1],rsum[2]);
+#else
+    alpha = rsum[1];
+#endif
+    DSLarfg_Private(&alpha,PetscSqrtReal(rsum[0]),tauq+k,&scale);
+    d[k] = PetscRealPart(alpha);
+    for (i=PetscMax(rstart,k+1);i<rend;i++) pA[i-rstart+k*lda] *= scale;
+    if (k>=rstart && k<rend) pA[k-rstart+k*lda] = 1.0;
+    if (k==N-1) {
+      taup[k] = 0.0;
+      break;
+    }
+
+    /* y = v'*A(k:M,k+1:N) together with row k of A, in a single reduction */
+    PetscCall(PetscArrayzero(buf,2*m));
+    if (nr_) PetscCallBLAS("BLASgemv",BLASgemv_("C",&nr_,&m_,&sone,pA+(i0-rstart)+(k+1)*lda,&lda_,pA+(i0-rstart)+k*lda,&one,&szero,buf,&one));
+    if (k>=rstart && k<rend) for (i=0;i<m;i++) buf[m+i] = pA[k-rstart+(k+1+i)*lda];
+    PetscCall(PetscMPIIntCast(2*m,&len));
+    PetscCallMPI(MPIU_Allreduce(buf,y,len,MPIU_SCALAR,MPIU_SUM,comm));
+    for (i=0;i<m;i++) y[i] = PetscConj(y[i]);
+
+    /* apply H(k)' from the left, A(k:M,k+1:N) = A(k:M,k+1:N) - conj(tauq)*v*y, also to the copy of row k */
+    if (tauq[k]!=0.0) {
+      alpha = -PetscConj(tauq[k]);
+      if (nr_) PetscCallBLAS("BLASgemm",BLASgemm_("N","N",&nr_,&m_,&one,&alpha,pA+(i0-rstart)+k*lda,&lda_,y,&one,&sone,pA+(i0-rstart)+(k+1)*lda,&lda_));
+      for (i=0;i<m;i++) y[m+i] += alpha*y[i];
+      PetscCall(PetscLogFlops(4.0*(rend-i0)*m));
+    }
+
+    /* reflector G(k) that annihilates A(k,k+2:N), computed redundantly from the conjugate of row k */
+    for (i=0;i<m;i++) u[i] = PetscConj(y[m+i]);
+    xnorm = 0.0;
+    for (i=1;i<m;i++) xnorm += PetscRealPart(PetscConj(u[i])*u[i]);
+    alpha = u[0];
+    DSLarfg_Private(&alpha,PetscSqrtReal(xnorm),taup+k,&scale);
+    e[k] = PetscRealPart(alpha);
+    u[0] = 1.0;
+    for (i=1;i<m;i++) u[i] *= scale;
+    for (i=PetscMax(cstart,k+1);i<cend;i++) G[i-cstart+k*(cend-cstart)] = u[i-k-1];
+
+    /* apply G(k) from the right, A(k+1:M,k+1:N) = A(k+1:M,k+1:N) - taup*(A(k+1:M,k+1:N)*u)*u' */
+    i0 = PetscMax(rstart,k+1);
+    PetscCall(PetscBLASIntCast(PetscMax(rend-i0,0),&nr_));
+    if (taup[k]!=0.0 && nr_) {
+      PetscCallBLAS("BLASgemv",BLASgemv_("N",&nr_,&m_,&sone,pA+(i0-rstart)+(k+1)*lda,&lda_,u,&one,&szero,z,&one));
+      alpha = -taup[k];
+      PetscCallBLAS("BLASgemm",BLASgemm_("N","C",&nr_,&m_,&one,&alpha,z,&nr_,u,&m_,&sone,pA+(i0-rstart)+(k+1)*lda,&lda_));
+      PetscCall(PetscLogFlops(4.0*(rend-i0)*m));
+    }
+  }
+  PetscCall(MatDenseRestoreArray(A,&pA));
+  PetscCall(PetscFree4(buf,y,u,z));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   DSBackTransformDistributed_SVD - Computes X = Q*X and Y = P*Y, where Q and P are the
+   transformations computed by DSReduceDistributed_SVD() on matrix A. X contains the rows
+   of the left singular vectors of B corresponding to the local rows of A (zero for rows
+   beyond N), and Y the rows of the right singular vectors of B corresponding to the local
+   columns of A, both with nc columns.
+*/
+PetscErrorCode DSBackTransformDistributed_SVD(Mat A,const PetscScalar *tauq,const PetscScalar *taup,const PetscScalar *G,PetscInt nc,PetscScalar *X,PetscInt ldx,PetscScalar *Y,PetscInt ldy)
+{
+  PetscInt          N,rstart,rend,cstart,cend,lda;
+  const PetscScalar *pA;
+  MPI_Comm          comm;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectGetComm((PetscObject)A,&comm));
+  PetscCall(MatGetSize(A,NULL,&N));
+  PetscCall(MatGetOwnershipRange(A,&rstart,&rend));
+  PetscCall(MatGetOwnershipRangeColumn(A,&cstart,&cend));
+  PetscCall(MatDenseGetLDA(A,&lda));
+  PetscCall(MatDenseGetArrayRead(A,&pA));
+  PetscCall(DSApplyReflectors_Private(comm,N,0,pA,lda,rstart,rend,tauq,nc,X,ldx));
+  PetscCall(MatDenseRestoreArrayRead(A,&pA));
+  PetscCall(DSApplyReflectors_Private(comm,N-1,1,G,cend-cstart,cstart,cend,taup,nc,Y,ldy));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
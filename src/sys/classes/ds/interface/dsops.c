@@ -741,6 +741,70 @@ PetscErrorCode DSSolve(DS ds,PetscScalar eigr[],PetscScalar eigi[])
   PetscFunctionReturn(PETSC_SUCCESS);
 }
 
+/*@
+   DSSolveBatch - Solves a batch of small independent problems of the same type.
+
+   Not Collective
+
+   Input Parameters:
++  ds - the direct solver context
+.  nb - number of problems in the batch
+.  n  - number of rows of each problem
+.  m  - number of columns of each problem
+-  A  - array containing the nb matrices
+
+   Output Parameters:
++  w  - array to store the computed eigenvalues or singular values
+.  X  - array to store the eigenvectors or left singular vectors (optional)
+-  Y  - array to store the right singular vectors (optional)
+
+   Notes:
+   This function is intended for applications that must solve a large number of
+   tiny dense problems, where the overhead of setting up the DS object for each of
+   them would dominate. Only the type of ds is used, it is not necessary to call
+   DSAllocate() or DSSetDimensions(), and the matrices stored in ds are not modified.
+
+   The nb matrices are stored one after the other in A, each of them in column-major
+   order with leading dimension n, that is, entry (i,j) of the b-th problem is
+   A[b*n*m+i+j*n]. The arrays X and Y follow the same layout. The contents of A
+   are destroyed on output.
+
+   Currently, only DSHEP and DSSVD are supported. In DSHEP the matrices must be
+   square (m=n) and Hermitian, w contains the nb*n eigenvalues of the batch, in
+   ascending order for each problem, X (if not NULL) is filled with the nb*n*n
+   entries of the eigenvectors, and Y must be NULL. In DSSVD, with k=min(n,m),
+   w contains the nb*k singular values in descending order, X the n x k matrices
+   of left singular vectors and Y the m x k matrices of right singular vectors.
+   The sorting criterion of ds is not taken into account.
+
+   If SLEPc has been built with OpenMP, the problems of the batch are distributed
+   among the threads. In real arithmetic, symmetric problems of very small size are
+   solved with a cyclic Jacobi method instead of LAPACK.
+
+   Level: advanced
+
+.seealso: DSSolve(), DSSetType()
+@*/
+PetscErrorCode DSSolveBatch(DS ds,PetscInt nb,PetscInt n,PetscInt m,PetscScalar A[],PetscScalar w[],PetscScalar X[],PetscScalar Y[])
+{
+  PetscFunctionBegin;
+  PetscValidHeaderSpecific(ds,DS_CLASSID,1);
+  PetscValidType(ds,1);
+  PetscCheck(nb>=0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Number of problems must be non-negative, got %" PetscInt_FMT,nb);
+  PetscCheck(n>0 && m>0,PETSC_COMM_SELF,PETSC_ERR_ARG_OUTOFRANGE,"Problem dimensions must be positive, got %" PetscInt_FMT "x%" PetscInt_FMT,n,m);
+  if (!nb) PetscFunctionReturn(PETSC_SUCCESS);
+  PetscAssertPointer(A,5);
+  PetscAssertPointer(w,6);
+  PetscCheck(ds->ops->solvebatch,PETSC_COMM_SELF,PETSC_ERR_SUP,"DS type %s does not support batched solves",((PetscObject)ds)->type_name);
+  PetscCall(PetscInfo(ds,"Starting batched solve of %" PetscInt_FMT " problems of size %" PetscInt_FMT "x%" PetscInt_FMT "\n",nb,n,m));
+  PetscCall(PetscLogEventBegin(DS_Solve,ds,0,0,0));
+  PetscCall(PetscFPTrapPush(PETSC_FP_TRAP_OFF));
+  PetscUseTypeMethod(ds,solvebatch,nb,n,m,A,w,X,Y);
+  PetscCall(PetscFPTrapPop());
+  PetscCall(PetscLogEventEnd(DS_Solve,ds,0,0,0));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    DSSort - Sorts the result of DSSolve() according to a given sorting
    criterion.
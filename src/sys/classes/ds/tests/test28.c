@@ -0,0 +1,105 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test DSSolveBatch() with DSHEP and DSSVD.\n\n";
+
+#include <slepcds.h>
+
+int main(int argc,char **argv)
+{
+  DS             ds;
+  PetscScalar    *A,*B,*w,*X,*Y,s;
+  PetscReal      lambda,err,rnorm,tol=1000*PETSC_MACHINE_EPSILON;
+  PetscInt       b,i,j,l,nb=5,n=6,m=4,k;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-nb",&nb,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-m",&m,NULL));
+  k = PetscMin(n,m);
+  PetscCall(DSCreate(PETSC_COMM_WORLD,&ds));
+
+  /* Batch of symmetric problems: 1-D Laplacian shifted by b */
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Solve a batch of %" PetscInt_FMT " problems of type HEP - dimension %" PetscInt_FMT ".\n",nb,n));
+  PetscCall(DSSetType(ds,DSHEP));
+  PetscCall(PetscCalloc5(nb*n*PetscMax(n,m),&A,nb*n*PetscMax(n,m),&B,nb*n,&w,nb*n*n,&X,nb*n*m,&Y));
+  for (b=0;b<nb;b++) {
+    for (i=0;i<n;i++) {
+      A[b*n*n+i+i*n] = 2.0+b;
+      if (i>0) A[b*n*n+i+(i-1)*n] = -1.0;
+      if (i<n-1) A[b*n*n+i+(i+1)*n] = -1.0;
+    }
+  }
+  PetscCall(PetscArraycpy(B,A,nb*n*n));
+  PetscCall(DSSolveBatch(ds,nb,n,n,A,w,X,NULL));
+  err = 0.0; rnorm = 0.0;
+  for (b=0;b<nb;b++) {
+    for (j=0;j<n;j++) {
+      lambda = 2.0+b-2.0*PetscCosReal((j+1)*PETSC_PI/(n+1));
+      err = PetscMax(err,PetscAbsScalar(w[b*n+j]-lambda));
+      for (i=0;i<n;i++) {
+        s = -w[b*n+j]*X[b*n*n+i+j*n];
+        for (l=0;l<n;l++) s += B[b*n*n+i+l*n]*X[b*n*n+l+j*n];
+        rnorm = PetscMax(rnorm,PetscAbsScalar(s));
+      }
+    }
+  }
+  if (err<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Eigenvalues are correct\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Error in eigenvalues %g\n",(double)err));
+  if (rnorm<tol) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Residuals are below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Residual norm %g\n",(double)rnorm));
+
+  /* Batch of rectangular problems: Toeplitz matrix scaled by b+1 */
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Solve a batch of %" PetscInt_FMT " problems of type SVD - dimension %" PetscInt_FMT "x%" PetscInt_FMT ".\n",nb,n,m));
+  PetscCall(DSSetType(ds,DSSVD));
+  PetscCall(PetscArrayzero(A,nb*n*m));
+  for (b=0;b<nb;b++) {
+    for (i=0;i<k;i++) A[b*n*m+i+i*n] = b+1.0;
+    for (i=0;i<k-1;i++) A[b*n*m+i+(i+1)*n] = 2.0*(b+1.0);
+    for (i=1;i<PetscMin(n,m+1);i++) A[b*n*m+i+(i-1)*n] = -(b+1.0);
+  }
+  PetscCall(PetscArraycpy(B,A,nb*n*m));
+  PetscCall(DSSolveBatch(ds,nb,n,m,A,w,X,Y));
+  err = 0.0; rnorm = 0.0;
+  for (b=0;b<nb;b++) {
+    for (j=0;j<k;j++) {
+      /* singular values scale with the matrix */
+      err = PetscMax(err,PetscAbsScalar(w[b*k+j]-(b+1.0)*w[j]));
+      for (i=0;i<n;i++) {
+        s = -w[b*k+j]*X[b*n*k+i+j*n];
+        for (l=0;l<m;l++) s += B[b*n*m+i+l*n]*Y[b*m*k+l+j*m];
+        rnorm = PetscMax(rnorm,PetscAbsScalar(s));
+      }
+    }
+  }
+  if (err<tol*nb) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Singular values are correct\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Error in singular values %g\n",(double)err));
+  if (rnorm<tol*nb) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Residuals are below tolerance\n"));
+  else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Residual norm %g\n",(double)rnorm));
+
+  PetscCall(PetscFree5(A,B,w,X,Y));
+  PetscCall(DSDestroy(&ds));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   test:
+      suffix: 1
+      requires: !single
+
+   test:
+      suffix: 2
+      args: -nb 3 -n 20 -m 25
+      requires: !single
+
+TEST*/
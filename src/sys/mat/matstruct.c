@@ -10,6 +10,104 @@
 
 #include <slepc/private/slepcimpl.h>            /*I "slepcsys.h" I*/
 
+/* work matrices for the fused product with the BSE matrix, with two columns each */
+typedef struct {
+  Mat X,Z;    /* input blocks [x1 conj(x2)] and [x2 conj(x1)] */
+  Mat Y,W;    /* products R*X and C*Z */
+} MatBSEMult_Ctx;
+
+static PetscErrorCode MatBSEMultDestroy_Private(void **ptr)
+{
+  MatBSEMult_Ctx *ctx = (MatBSEMult_Ctx*)*ptr;
+
+  PetscFunctionBegin;
+  PetscCall(MatDestroy(&ctx->X));
+  PetscCall(MatDestroy(&ctx->Z));
+  PetscCall(MatDestroy(&ctx->Y));
+  PetscCall(MatDestroy(&ctx->W));
+  PetscCall(PetscFree(*ptr));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
+/*
+   Product y=H*x with the BSE matrix H = [ R C; -C^H -R^T ]
+
+   Since R is Hermitian and C is complex symmetric, the bottom half can be written as
+
+       y2 = -conj(R*conj(x2)+C*conj(x1)),
+
+   so both halves are obtained from the two-column products R*[x1 conj(x2)] and
+   C*[x2 conj(x1)]. In this way, R and C are traversed only once, instead of once for
+   each block of the nest including the (virtual) transposed ones.
+*/
+static PetscErrorCode MatMult_BSE(Mat H,Vec x,Vec y)
+{
+  MatBSEMult_Ctx *ctx;
+  PetscContainer container;
+  Mat            R,C;
+  IS             is[2];
+  Vec            x1,x2,y1,y2,v,w;
+  PetscInt       n,N;
+  VecType        vtype;
+
+  PetscFunctionBegin;
+  PetscCall(PetscObjectQuery((PetscObject)H,"SlepcMatBSEMult",(PetscObject*)&container));
+  PetscCall(PetscContainerGetPointer(container,(void**)&ctx));
+  PetscCall(MatNestGetSubMat(H,0,0,&R));
+  PetscCall(MatNestGetSubMat(H,0,1,&C));
+  PetscCall(MatNestGetISs(H,is,NULL));
+  if (!ctx->X) {
+    PetscCall(MatGetLocalSize(R,NULL,&n));
+    PetscCall(MatGetSize(R,NULL,&N));
+    PetscCall(MatGetVecType(R,&vtype));  /* dense storage on the same device as R */
+    PetscCall(MatCreateDenseFromVecType(PetscObjectComm((PetscObject)H),vtype,n,PETSC_DECIDE,N,2,PETSC_DECIDE,NULL,&ctx->X));
+    PetscCall(MatDuplicate(ctx->X,MAT_DO_NOT_COPY_VALUES,&ctx->Z));
+  }
+
+  /* build the input blocks */
+  PetscCall(VecGetSubVector(x,is[0],&x1));
+  PetscCall(VecGetSubVector(x,is[1],&x2));
+  PetscCall(MatDenseGetColumnVecWrite(ctx->X,0,&v));
+  PetscCall(VecCopy(x1,v));
+  PetscCall(MatDenseRestoreColumnVecWrite(ctx->X,0,&v));
+  PetscCall(MatDenseGetColumnVecWrite(ctx->X,1,&v));
+  PetscCall(VecCopy(x2,v));
+  PetscCall(VecConjugate(v));
+  PetscCall(MatDenseRestoreColumnVecWrite(ctx->X,1,&v));
+  PetscCall(MatDenseGetColumnVecWrite(ctx->Z,0,&v));
+  PetscCall(VecCopy(x2,v));
+  PetscCall(MatDenseRestoreColumnVecWrite(ctx->Z,0,&v));
+  PetscCall(MatDenseGetColumnVecWrite(ctx->Z,1,&v));
+  PetscCall(VecCopy(x1,v));
+  PetscCall(VecConjugate(v));
+  PetscCall(MatDenseRestoreColumnVecWrite(ctx->Z,1,&v));
+  PetscCall(VecRestoreSubVector(x,is[0],&x1));
+  PetscCall(VecRestoreSubVector(x,is[1],&x2));
+
+  /* block products */
+  PetscCall(MatMatMult(R,ctx->X,ctx->Y?MAT_REUSE_MATRIX:MAT_INITIAL_MATRIX,PETSC_DEFAULT,&ctx->Y));
+  PetscCall(MatMatMult(C,ctx->Z,ctx->W?MAT_REUSE_MATRIX:MAT_INITIAL_MATRIX,PETSC_DEFAULT,&ctx->W));
+
+  /* y1 = Y(:,0)+W(:,0), y2 = -conj(Y(:,1)+W(:,1)) */
+  PetscCall(VecGetSubVector(y,is[0],&y1));
+  PetscCall(MatDenseGetColumnVecRead(ctx->Y,0,&v));
+  PetscCall(MatDenseGetColumnVecRead(ctx->W,0,&w));
+  PetscCall(VecWAXPY(y1,1.0,v,w));
+  PetscCall(MatDenseRestoreColumnVecRead(ctx->W,0,&w));
+  PetscCall(MatDenseRestoreColumnVecRead(ctx->Y,0,&v));
+  PetscCall(VecRestoreSubVector(y,is[0],&y1));
+  PetscCall(VecGetSubVector(y,is[1],&y2));
+  PetscCall(MatDenseGetColumnVecRead(ctx->Y,1,&v));
+  PetscCall(MatDenseGetColumnVecRead(ctx->W,1,&w));
+  PetscCall(VecWAXPY(y2,1.0,v,w));
+  PetscCall(MatDenseRestoreColumnVecRead(ctx->W,1,&w));
+  PetscCall(MatDenseRestoreColumnVecRead(ctx->Y,1,&v));
+  PetscCall(VecConjugate(y2));
+  PetscCall(VecScale(y2,-1.0));
+  PetscCall(VecRestoreSubVector(y,is[1],&y2));
+  PetscFunctionReturn(PETSC_SUCCESS);
+}
+
 /*@
    MatCreateBSE - Create a matrix that can be used to define a structured eigenvalue
    problem of type BSE (Bethe-Salpeter Equation).
@@ -36,7 +134,11 @@
 
    In the current implementation, H is a MATNEST matrix, where R and C form the top
    block row, while the bottom block row is composed of matrices of type
-   MATTRANSPOSEVIRTUAL and MATHERMITIANTRANSPOSEVIRTUAL scaled by -1.
+   MATTRANSPOSEVIRTUAL and MATHERMITIANTRANSPOSEVIRTUAL scaled by -1. The product
+   with H is not done block by block, but exploiting the structure so that R and C
+   are traversed only once, by means of a product with a block of two vectors. This
+   applies to MatMult() only; products with a block of vectors, e.g., MatMatMult() or
+   BVMatMult(), are not specialized and are computed block by block by MATNEST.
 
    Level: intermediate
 
@@ -47,6 +149,7 @@ PetscErrorCode MatCreateBSE(Mat R,Mat C,Mat *H)
   PetscInt       Mr,Mc,Nr,Nc,mr,mc,nr,nc;
   Mat            block[4] = { R, C, NULL, NULL };
   SlepcMatStruct mctx;
+  MatBSEMult_Ctx *bctx;
 
   PetscFunctionBegin;
   PetscValidHeaderSpecific(R,MAT_CLASSID,1);
@@ -76,5 +179,10 @@ PetscErrorCode MatCreateBSE(Mat R,Mat C,Mat *H)
   PetscCall(PetscNew(&mctx));
   mctx->cookie = SLEPC_MAT_STRUCT_BSE;
   PetscCall(PetscObjectContainerCompose((PetscObject)*H,"SlepcMatStruct",mctx,PetscCtxDestroyDefault));
+
+  /* structure-exploiting product */
+  PetscCall(PetscNew(&bctx));
+  PetscCall(PetscObjectContainerCompose((PetscObject)*H,"SlepcMatBSEMult",bctx,MatBSEMultDestroy_Private));
+  PetscCall(MatSetOperation(*H,MATOP_MULT,(void(*)(void))MatMult_BSE));
   PetscFunctionReturn(PETSC_SUCCESS);
 }
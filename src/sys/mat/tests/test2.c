@@ -0,0 +1,120 @@
+/*
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+   SLEPc - Scalable Library for Eigenvalue Problem Computations
+   Copyright (c) 2002-, Universitat Politecnica de Valencia, Spain
+
+   This file is part of SLEPc.
+   SLEPc is distributed under a 2-clause BSD license (see LICENSE).
+   - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+*/
+
+static char help[] = "Test the product with the matrix obtained from MatCreateBSE.\n\n";
+
+#include <slepcsys.h>
+
+int main(int argc,char **argv)
+{
+  Mat            R,C,H,Hn,block[4];
+  Vec            x,y,z;
+  PetscRandom    rand;
+  PetscInt       i,k,Istart,Iend,n=10;
+  PetscScalar    a,b,d;
+  PetscReal      c=4.5,nrm,err;
+
+  PetscFunctionBeginUser;
+  PetscCall(SlepcInitialize(&argc,&argv,NULL,help));
+  PetscCall(PetscOptionsGetInt(NULL,NULL,"-n",&n,NULL));
+  PetscCall(PetscPrintf(PETSC_COMM_WORLD,"MatCreateBSE product test, n=%" PetscInt_FMT "\n",n));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Create R=pentadiag{a,b,c,conj(b),conj(a)} and C=tridiag{b,d,b}
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+#if defined(PETSC_USE_COMPLEX)
+  a = PetscCMPLX(-0.1,0.2);
+  b = PetscCMPLX(1.0,0.5);
+  d = PetscCMPLX(2.0,0.2);
+#else
+  a = -0.1;
+  b = 1.0;
+  d = 2.0;
+#endif
+
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&R));
+  PetscCall(MatSetSizes(R,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(R));
+  PetscCall(MatCreate(PETSC_COMM_WORLD,&C));
+  PetscCall(MatSetSizes(C,PETSC_DECIDE,PETSC_DECIDE,n,n));
+  PetscCall(MatSetFromOptions(C));
+
+  PetscCall(MatGetOwnershipRange(R,&Istart,&Iend));
+  for (i=Istart;i<Iend;i++) {
+    if (i>1) PetscCall(MatSetValue(R,i,i-2,a,INSERT_VALUES));
+    if (i>0) PetscCall(MatSetValue(R,i,i-1,b,INSERT_VALUES));
+    PetscCall(MatSetValue(R,i,i,c,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(R,i,i+1,PetscConj(b),INSERT_VALUES));
+    if (i<n-2) PetscCall(MatSetValue(R,i,i+2,PetscConj(a),INSERT_VALUES));
+    if (i>0) PetscCall(MatSetValue(C,i,i-1,b,INSERT_VALUES));
+    PetscCall(MatSetValue(C,i,i,d,INSERT_VALUES));
+    if (i<n-1) PetscCall(MatSetValue(C,i,i+1,b,INSERT_VALUES));
+  }
+  PetscCall(MatAssemblyBegin(R,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyBegin(C,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(R,MAT_FINAL_ASSEMBLY));
+  PetscCall(MatAssemblyEnd(C,MAT_FINAL_ASSEMBLY));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Create H with MatCreateBSE and a plain nest Hn with the same blocks
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(MatCreateBSE(R,C,&H));
+  block[0] = R;
+  block[1] = C;
+  PetscCall(MatCreateHermitianTranspose(C,&block[2]));
+  PetscCall(MatScale(block[2],-1.0));
+  PetscCall(MatCreateTranspose(R,&block[3]));
+  PetscCall(MatScale(block[3],-1.0));
+  PetscCall(MatCreateNest(PETSC_COMM_WORLD,2,NULL,2,NULL,block,&Hn));
+  PetscCall(MatDestroy(&block[2]));
+  PetscCall(MatDestroy(&block[3]));
+
+  /* - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -
+     Compare the structured product with the block-by-block one
+     - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - */
+  PetscCall(MatCreateVecs(H,&x,&y));
+  PetscCall(VecDuplicate(y,&z));
+  PetscCall(PetscRandomCreate(PETSC_COMM_WORLD,&rand));
+  PetscCall(PetscRandomSetFromOptions(rand));
+  for (k=0;k<3;k++) {
+    PetscCall(VecSetRandom(x,rand));
+    PetscCall(MatMult(H,x,y));
+    PetscCall(MatMult(Hn,x,z));
+    PetscCall(VecNorm(z,NORM_2,&nrm));
+    PetscCall(VecAXPY(z,-1.0,y));
+    PetscCall(VecNorm(z,NORM_2,&err));
+    if (err<100*PETSC_MACHINE_EPSILON*nrm) PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Product %" PetscInt_FMT ": relative difference < 100*eps\n",k));
+    else PetscCall(PetscPrintf(PETSC_COMM_WORLD,"Product %" PetscInt_FMT ": relative difference %g\n",k,(double)(err/nrm)));
+  }
+
+  PetscCall(PetscRandomDestroy(&rand));
+  PetscCall(VecDestroy(&x));
+  PetscCall(VecDestroy(&y));
+  PetscCall(VecDestroy(&z));
+  PetscCall(MatDestroy(&R));
+  PetscCall(MatDestroy(&C));
+  PetscCall(MatDestroy(&H));
+  PetscCall(MatDestroy(&Hn));
+  PetscCall(SlepcFinalize());
+  return 0;
+}
+
+/*TEST
+
+   testset:
+      output_file: output/test2_1.out
+      test:
+         suffix: 1
+         nsize: 1
+      test:
+         suffix: 2
+         nsize: 2
+
+TEST*/